@@ -0,0 +1,106 @@
+/*!
+* @file  OpenFIREautofire.h
+* @brief Timer-driven trigger & solenoid timing for OpenFIRE microcontroller clients.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENFIREAUTOFIRE_H_
+#define _OPENFIREAUTOFIRE_H_
+
+#include <cstdint>
+
+/// @brief      Fires shots from a hardware timer, so trigger reports and solenoid kicks share one timebase
+/// @details    Call tick() from a periodic timer interrupt with the trigger's current state. Each shot is
+///             solenoidOnLength of "on" (trigger reported pressed, solenoid energised) followed by at least
+///             solenoidOffLength of "off", counted in timer ticks - so with autofire (the autofire toggle or
+///             autofireSwitch) a held trigger repeats at exactly on + off, however busy the main loop is.
+///             Without autofire, each pull fires one solenoid pulse and the trigger is reported as held.
+///             The timer ISR drives the solenoid pin from solenoid(); the HID report takes trigger().
+class OF_Autofire
+{
+public:
+    /// @param      tickUs
+    ///             Period of the timer calling tick()
+    OF_Autofire(uint32_t tickUs = 1000) : tickUs(tickUs) {}
+
+    /// @brief      Sets shot timing from the solenoidOnLength & solenoidOffLength settings (both in ms)
+    /// @note       Safe to call from the main loop while the timer runs; takes effect from the next shot.
+    void configure(uint32_t onMs, uint32_t offMs) {
+        onTicks = toTicks(onMs);
+        offTicks = toTicks(offMs);
+    }
+
+    /// @brief      Sets whether a held trigger repeats (autofire toggle, or autofireSwitch closed)
+    void setAutofire(bool enabled) { autofire = enabled; }
+
+    /// @brief      Sets whether shots energise the solenoid (solenoid toggle, and solenoidSwitch if mapped)
+    void setSolenoid(bool enabled) { solenoidEnabled = enabled; }
+
+    /// @brief      Advances one timer period
+    /// @param      triggerHeld
+    ///             Trigger button state, sampled by the timer
+    void tick(bool triggerHeld) {
+        if(remaining && --remaining == 0) {
+            if(state == stateOn) {
+                state = stateOff;
+                remaining = offTicks;
+            } else state = stateIdle;
+        }
+
+        if(!triggerHeld) armed = true;
+        if(state == stateIdle && triggerHeld && (armed || autofire)) {
+            state = stateOn;
+            remaining = onTicks;
+            armed = false;
+            ++shots;
+        }
+
+        held = triggerHeld;
+    }
+
+    /// @brief      Whether the solenoid should be energised right now
+    bool solenoid() const { return solenoidEnabled && state == stateOn; }
+
+    /// @brief      Whether to report the trigger as pressed: toggling per shot under autofire, else as held
+    bool trigger() const { return held && (!autofire || state == stateOn); }
+
+    volatile uint32_t shots = 0;    // shots fired since startup
+
+private:
+    enum {
+        stateIdle = 0,
+        stateOn,
+        stateOff
+    };
+
+    uint32_t toTicks(uint32_t ms) const {
+        const uint32_t ticks = (ms * 1000 + tickUs - 1) / tickUs;
+        return ticks ? ticks : 1;
+    }
+
+    uint32_t tickUs;
+    volatile uint32_t onTicks = 1;
+    volatile uint32_t offTicks = 1;
+    uint32_t remaining = 0;
+    volatile uint8_t state = stateIdle;
+    volatile bool held = false;
+    bool armed = true;
+    volatile bool autofire = false;
+    volatile bool solenoidEnabled = true;
+};
+
+#endif // _OPENFIREAUTOFIRE_H_
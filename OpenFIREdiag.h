@@ -0,0 +1,458 @@
+/*!
+* @file  OpenFIREdiag.h
+* @brief Lightweight runtime diagnostics for OpenFIRE microcontroller clients,
+*        reported to configuration apps over the serial commands in OpenFIREshared.h.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENFIREDIAG_H_
+#define _OPENFIREDIAG_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "OpenFIREshared.h"
+
+/// @brief      Fixed-size histogram of durations in microseconds
+/// @details    Buckets are exact up to 4us, then split each power of two into four,
+///             so any percentile is within 25% of the true value; the last bucket collects everything from 7168us.
+///             Adding a sample is a few integer ops and never allocates.
+class OF_Histogram
+{
+public:
+    static constexpr unsigned int bucketsCount = 48;
+
+    /// @brief      Gets the bucket a duration is counted in
+    static constexpr unsigned int bucketOf(uint32_t us) {
+        if(us < 4) return us;
+        unsigned int log2 = 0;
+        for(uint32_t v = us; v > 1; v >>= 1) ++log2;
+        const unsigned int bucket = 4 * (log2 - 1) + ((us >> (log2 - 2)) & 3);
+        return bucket < bucketsCount ? bucket : bucketsCount - 1;
+    }
+
+    /// @brief      Gets the largest duration counted in a bucket
+    static constexpr uint32_t bucketMax(unsigned int bucket) {
+        if(bucket < 4) return bucket;
+        if(bucket >= bucketsCount - 1) return UINT32_MAX;
+        const unsigned int shift = bucket / 4 - 1;
+        return ((4u + bucket % 4) << shift) + (1u << shift) - 1;
+    }
+
+    void add(uint32_t us) {
+        ++buckets[bucketOf(us)];
+        ++count;
+        sum += us;
+        if(us < min) min = us;
+        if(us > max) max = us;
+    }
+
+    void reset() {
+        std::memset(buckets, 0, sizeof(buckets));
+        count = 0;
+        sum = 0;
+        min = UINT32_MAX;
+        max = 0;
+    }
+
+    /// @brief      Gets an upper bound for a percentile of the samples counted so far
+    /// @param      pct
+    ///             Percentile, 1-100
+    /// @return     Duration in microseconds (never more than max), or 0 if nothing has been counted
+    uint32_t percentile(unsigned int pct) const {
+        if(!count) return 0;
+        const uint64_t rank = ((uint64_t)count * pct + 99) / 100;
+        uint64_t seen = 0;
+        for(unsigned int bucket = 0; bucket < bucketsCount; ++bucket)
+            if((seen += buckets[bucket]) >= rank)
+                return bucketMax(bucket) < max ? bucketMax(bucket) : max;
+        return max;
+    }
+
+    uint32_t avg() const { return count ? sum / count : 0; }
+
+    /// @brief      Summarises the histogram for sLoopStatsUpd or sLatencyStatsUpd
+    OF_Const::timingStat_t summary() const {
+        auto clip = [](uint32_t us) { return (uint16_t)(us < UINT16_MAX ? us : UINT16_MAX); };
+        return { count, clip(count ? min : 0), clip(avg()), clip(percentile(50)), clip(percentile(99)), clip(max) };
+    }
+
+    uint32_t buckets[bucketsCount] = {};
+    uint32_t count = 0;
+    uint64_t sum = 0;
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0;
+};
+
+static_assert(OF_Histogram::bucketOf(7) == 7 && OF_Histogram::bucketOf(8) == 8 &&
+              OF_Histogram::bucketMax(OF_Histogram::bucketOf(7167)) == 7167, "OF_Histogram bucket edges are off");
+
+/// @brief      Per-section timing of the firmware's main loop
+/// @details    Sections are OF_Const::loopSections_e. Wrap each part of the loop in start()/stop() (or a Scope),
+///             and loopWhole around the whole iteration; report() then packs the sLoopStatsUpd payload.
+///             The clock is whatever the board has handy: micros() with 1 tick per us,
+///             or a cycle counter (e.g. ESP32's ccount) with F_CPU / 1000000.
+class OF_LoopStats
+{
+public:
+    typedef uint32_t (*clockFn_t)();
+
+    OF_LoopStats(clockFn_t now, uint32_t ticksPerUs = 1) : now(now), ticksPerUs(ticksPerUs) {}
+
+    void start(int section) { started[section] = now(); }
+
+    void stop(int section) {
+        const uint32_t ticks = now() - started[section]; // wraps correctly as long as a section takes < 2^32 ticks
+        sections[section].add(ticks / ticksPerUs);
+    }
+
+    /// @brief      Times a section until the end of the enclosing scope
+    class Scope
+    {
+    public:
+        Scope(OF_LoopStats &stats, int section) : stats(stats), section(section) { stats.start(section); }
+        ~Scope() { stats.stop(section); }
+    private:
+        OF_LoopStats &stats;
+        int section;
+    };
+
+    void reset() {
+        for(auto &section : sections)
+            section.reset();
+    }
+
+    /// @brief      Packs the sLoopStatsUpd payload: section count, then every section's encoded summary
+    /// @param      out
+    ///             Buffer of at least reportSize bytes
+    /// @return     Number of bytes written
+    size_t report(uint8_t *out) const {
+        OF_Const::timingStat_t stats[OF_Const::loopSectionsCount];
+        for(int i = 0; i < OF_Const::loopSectionsCount; ++i)
+            stats[i] = sections[i].summary();
+        out[0] = OF_Const::loopSectionsCount;
+        return 1 + OF_Const::timingStatsEncode(stats, OF_Const::loopSectionsCount, out + 1);
+    }
+
+    static constexpr size_t reportSize = 1 + OF_Const::loopSectionsCount * OF_Const::timingStatSize;
+
+    OF_Histogram sections[OF_Const::loopSectionsCount];
+
+private:
+    clockFn_t now;
+    uint32_t ticksPerUs;
+    uint32_t started[OF_Const::loopSectionsCount] = {};
+};
+
+/// @brief      Fixed-size ring of timestamped events, for catching intermittent problems after the fact
+/// @details    Once full, the oldest records are overwritten (and counted as dropped), so the ring always holds
+///             the last Capacity events leading up to a dump. Capacity must be a power of two;
+///             the default 512 records take 4KB.
+/// @note       Not locked - log from one core only, or disable interrupts around log() if ISRs also log.
+template<size_t Capacity = 512>
+class OF_Trace
+{
+    static_assert(Capacity && !(Capacity & (Capacity - 1)), "OF_Trace capacity must be a power of two");
+    static_assert(Capacity <= UINT16_MAX, "OF_Trace capacity must fit the sTraceDump record count");
+
+public:
+    typedef uint32_t (*clockFn_t)();
+
+    OF_Trace(clockFn_t now) : now(now) {}
+
+    void log(uint8_t event, uint8_t arg = 0, uint16_t data = 0) {
+        if(!enabled) return;
+        records[head++ & (Capacity - 1)] = { now(), event, arg, data };
+    }
+
+    size_t size() const { return head < Capacity ? head : Capacity; }
+
+    void clear() { head = 0; }
+
+    /// @brief      Size of the sTraceDump payload for the records currently held
+    size_t dumpSize() const { return OF_Const::traceHeaderSize + size() * OF_Const::traceRecordSize; }
+
+    /// @brief      Packs the sTraceDump payload, oldest record first
+    /// @details    Logging is paused while packing, so a dump is always a consistent snapshot.
+    /// @param      out
+    ///             Buffer of at least dumpSize() bytes
+    /// @return     Number of bytes written
+    size_t dump(uint8_t *out) {
+        const bool wasEnabled = enabled;
+        enabled = false;
+        const size_t count = size();
+        uint8_t *p = out + OF_Const::traceHeaderEncode(count, head - count, out);
+        for(uint32_t i = head - count; i != head; ++i)
+            p += OF_Const::traceRecordEncode(records[i & (Capacity - 1)], p);
+        enabled = wasEnabled;
+        return p - out;
+    }
+
+    bool enabled = true;
+
+private:
+    clockFn_t now;
+    uint32_t head = 0;  // total records logged (wraps after 2^32)
+    OF_Const::traceRecord_t records[Capacity];
+};
+
+/// @brief      Per-type sError counters with rate limiting
+/// @details    Every error is counted, but each type is only sent as its own sError frame once per minGapMs;
+///             the rest are folded into a periodic sErrorStats summary (also sent on sGetErrorStats).
+///             So a flapping camera bus costs at most one sError per type per gap plus one summary per period,
+///             and the app still gets the full count, first/last times and latest detail code.
+class OF_ErrorStats
+{
+public:
+    OF_ErrorStats(uint32_t minGapMs = 1000, uint32_t summaryMs = 5000) : minGapMs(minGapMs), summaryMs(summaryMs) {
+        for(int i = 0; i < OF_Const::errorTypesCount; ++i)
+            stats[i] = { (uint8_t)(OF_Const::sErrCam + i), 0, 0, 0, 0, 0 };
+    }
+
+    /// @brief      Counts an error
+    /// @param      type
+    ///             sErrCam, sErrPeriphGeneric...
+    /// @return     true if it should be sent as its own frame now (see OF_Const::errorEncode()), false if it's been folded into the summary
+    bool record(int type, uint16_t detail, uint32_t nowMs) {
+        const int i = type - OF_Const::sErrCam;
+        if(i < 0 || i >= OF_Const::errorTypesCount) return true;
+        OF_Const::errorStat_t &stat = stats[i];
+        if(!stat.count++) stat.first = nowMs;
+        stat.last = nowMs;
+        stat.detail = detail;
+        if(sent[i] && nowMs - lastSent[i] < minGapMs) {
+            if(stat.suppressed < UINT16_MAX) ++stat.suppressed;
+            return false;
+        }
+        sent[i] = true;
+        lastSent[i] = nowMs;
+        return true;
+    }
+
+    /// @brief      Checks if suppressed errors are waiting and the summary period has passed
+    bool summaryDue(uint32_t nowMs) const {
+        if(nowMs - lastSummary < summaryMs) return false;
+        for(auto &stat : stats)
+            if(stat.suppressed) return true;
+        return false;
+    }
+
+    /// @brief      Packs the sErrorStats payload: type count, then every type that has occurred so far
+    /// @details    Resets the suppressed counts and restarts the summary period.
+    /// @param      out
+    ///             Buffer of at least reportSize bytes
+    /// @return     Number of bytes written
+    size_t report(uint8_t *out, uint32_t nowMs) {
+        OF_Const::errorStat_t seen[OF_Const::errorTypesCount];
+        size_t count = 0;
+        for(auto &stat : stats)
+            if(stat.count) {
+                seen[count++] = stat;
+                stat.suppressed = 0;
+            }
+        lastSummary = nowMs;
+        out[0] = count;
+        return 1 + OF_Const::errorStatsEncode(seen, count, out + 1);
+    }
+
+    static constexpr size_t reportSize = 1 + OF_Const::errorTypesCount * OF_Const::errorStatSize;
+
+    OF_Const::errorStat_t stats[OF_Const::errorTypesCount];
+
+private:
+    uint32_t minGapMs;
+    uint32_t summaryMs;
+    uint32_t lastSummary = 0;
+    uint32_t lastSent[OF_Const::errorTypesCount] = {};
+    bool sent[OF_Const::errorTypesCount] = {};
+};
+
+/// @brief      End-to-end input latency, measured while the app has the board in sLatencyTest mode
+/// @details    The board calls the event hooks below with micros() timestamps; each stage in
+///             OF_Const::latencyStages_e is closed on the next HID report after its starting event.
+///             A frame that arrives before the previous one was reported replaces it, so positions are
+///             measured from the frame they were solved from. A trigger edge that arrives while one is still
+///             pending is ignored instead: the pending press is measured from its first edge (so bounce
+///             doesn't shorten it), and the interrupt never rewrites triggerAt while the main loop may read it.
+/// @note       triggerEdge() is safe to call from the btnTrigger GPIO interrupt;
+///             the rest should be called from the main loop.
+class OF_Latency
+{
+public:
+    /// @brief      Starts (or restarts) measuring, clearing previous results
+    void begin() {
+        for(auto &stage : stages)
+            stage.reset();
+        triggerPending = framePending = positionPending = false;
+        enabled = true;
+    }
+
+    void end() { enabled = false; }
+
+    /// @brief      btnTrigger went active (ideally stamped in its GPIO interrupt)
+    /// @note       Ignored while an earlier edge is still waiting for its report - see the class details.
+    void triggerEdge(uint32_t nowUs) {
+        if(!enabled || triggerPending) return;
+        triggerAt = nowUs;
+        triggerPending = true;
+    }
+
+    /// @brief      Camera frame was captured; replaces any frame not reported yet
+    void frameCaptured(uint32_t nowUs) {
+        if(!enabled) return;
+        frameAt = nowUs;
+        framePending = true;
+        positionPending = false;
+    }
+
+    /// @brief      Position was solved from the last captured frame
+    void positionSolved(uint32_t nowUs) {
+        if(!enabled || !framePending) return;
+        stages[OF_Const::latencyFrameToPosition].add(nowUs - frameAt);
+        framePending = false;
+        positionPending = true;
+    }
+
+    /// @brief      HID report was handed to the USB stack
+    /// @param      hasTrigger
+    ///             Report carries the trigger press
+    /// @param      hasPosition
+    ///             Report carries the last solved position
+    void reportSubmitted(uint32_t nowUs, bool hasTrigger, bool hasPosition) {
+        if(!enabled) return;
+        if(hasTrigger && triggerPending) {
+            stages[OF_Const::latencyTriggerToReport].add(nowUs - triggerAt);
+            triggerPending = false;
+        }
+        if(hasPosition && positionPending) {
+            stages[OF_Const::latencyFrameToReport].add(nowUs - frameAt);
+            positionPending = false;
+        }
+    }
+
+    /// @brief      Packs the sLatencyStatsUpd payload: stage count, then every stage's encoded summary
+    /// @param      out
+    ///             Buffer of at least reportSize bytes
+    /// @return     Number of bytes written
+    size_t report(uint8_t *out) const {
+        OF_Const::timingStat_t stats[OF_Const::latencyStagesCount];
+        for(int i = 0; i < OF_Const::latencyStagesCount; ++i)
+            stats[i] = stages[i].summary();
+        out[0] = OF_Const::latencyStagesCount;
+        return 1 + OF_Const::timingStatsEncode(stats, OF_Const::latencyStagesCount, out + 1);
+    }
+
+    static constexpr size_t reportSize = 1 + OF_Const::latencyStagesCount * OF_Const::timingStatSize;
+
+    OF_Histogram stages[OF_Const::latencyStagesCount];
+    bool enabled = false;
+
+private:
+    volatile uint32_t triggerAt = 0;
+    volatile bool triggerPending = false;
+    uint32_t frameAt = 0;
+    bool framePending = false;
+    bool positionPending = false;
+};
+
+/// @brief      Flash wear and timing for the prefs layer's save, load and clear operations
+/// @details    Wrap each operation in begin()/end() (or a Scope), and call erased()/programmed()
+///             from wherever the prefs layer actually erases sectors and writes pages.
+///             Reported with sFlashStats in reply to sGetFlashStats.
+class OF_FlashStats
+{
+public:
+    typedef uint32_t (*clockFn_t)();
+
+    OF_FlashStats(clockFn_t now) : now(now) {}
+
+    void begin(int op) { started[op] = now(); }
+
+    void end(int op) {
+        const uint32_t us = now() - started[op];
+        OF_Const::flashOpStat_t &stat = stats.ops[op];
+        ++stat.count;
+        stat.lastUs = us;
+        if(us > stat.maxUs) stat.maxUs = us;
+        totalUs[op] += us;
+        stat.totalMs = totalUs[op] / 1000;
+    }
+
+    /// @brief      Times a flash operation until the end of the enclosing scope
+    class Scope
+    {
+    public:
+        Scope(OF_FlashStats &flash, int op) : flash(flash), op(op) { flash.begin(op); }
+        ~Scope() { flash.end(op); }
+    private:
+        OF_FlashStats &flash;
+        int op;
+    };
+
+    void erased(uint32_t sectors = 1) { stats.erases += sectors; }
+
+    void programmed(uint32_t bytes, uint32_t pages = 1) {
+        stats.programs += pages;
+        stats.bytesWritten += bytes;
+    }
+
+    /// @brief      Packs the sFlashStats payload
+    /// @param      out
+    ///             Buffer of at least OF_Const::flashStatsSize bytes
+    size_t report(uint8_t *out) const { return OF_Const::flashStatsEncode(stats, out); }
+
+    OF_Const::flashStats_t stats = {};
+
+private:
+    clockFn_t now;
+    uint32_t started[OF_Const::flashOpsCount] = {};
+    uint64_t totalUs[OF_Const::flashOpsCount] = {};
+};
+
+/// @brief      Time spent in each boot phase (OF_Const::bootPhases_e)
+/// @details    Reported with sBootStats after sFlashStats, so boot latency can be compared across firmware versions.
+class OF_BootStats
+{
+public:
+    typedef uint32_t (*clockFn_t)();
+
+    OF_BootStats(clockFn_t now) : now(now) {}
+
+    void begin(int phase) { started[phase] = now(); }
+    void end(int phase) { phaseUs[phase] = now() - started[phase]; }
+
+    /// @brief      Packs the sBootStats payload: phase count, then each phase's duration in us (uint32 LE)
+    /// @param      out
+    ///             Buffer of at least reportSize bytes
+    size_t report(uint8_t *out) const {
+        uint8_t *p = out;
+        *p++ = OF_Const::bootPhasesCount;
+        for(uint32_t us : phaseUs)
+            for(int b = 0; b < 4; ++b) *p++ = us >> (b * 8);
+        return p - out;
+    }
+
+    static constexpr size_t reportSize = 1 + OF_Const::bootPhasesCount * 4;
+
+    uint32_t phaseUs[OF_Const::bootPhasesCount] = {};
+
+private:
+    clockFn_t now;
+    uint32_t started[OF_Const::bootPhasesCount] = {};
+};
+
+#endif // _OPENFIREDIAG_H_
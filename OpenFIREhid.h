@@ -0,0 +1,218 @@
+/*!
+* @file  OpenFIREhid.h
+* @brief USB HID report building & change-driven sending for OpenFIRE microcontroller clients.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENFIREHID_H_
+#define _OPENFIREHID_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "OpenFIREshared.h"
+
+/// @brief      Packs gun state into preallocated HID reports, and only sends the ones that changed
+/// @details    The main loop sets buttons, position and analog values whenever it has them - that only
+///             writes into its own pending report buffers - then calls publish() once the update is complete.
+///             flush() is meant to be called from the USB start-of-frame callback, so reports go out at the
+///             start of the next frame with the freshest published state; each report is sent only if it
+///             differs from the last one sent, or its keep-alive interval has passed. Reports are all
+///             reportSize bytes, so comparing one is a single 8-byte compare.
+///             flush() only ever reads the published copies, each guarded by a sequence counter, so a report
+///             is never sent half updated (new x with old y, half a button mask) even if the SOF interrupt
+///             lands in the middle of publish(); that report just waits for the next frame. No locking is
+///             needed from the caller, as long as the setters and publish() are only called from one context.
+///
+///             Layouts (little endian):
+///              - reportMouse: buttons u8 (trigger = left, A = right, B = middle, C = back, Start = forward), x u16, y u16 (0-32767)
+///              - reportGamepad: buttons u16 (bit = boardInputs_e btnTrigger..btnHome), stick x i16, y i16, hat u8 (0-7 clockwise from up, 8 = centred)
+///              - reportKeyboard: boot keyboard - modifiers u8, reserved u8, six keycodes (arrow keys, for analogModeKeys)
+class OF_HidReports
+{
+public:
+    enum {
+        reportMouse = 0,
+        reportGamepad,
+        reportKeyboard,
+        reportsCount
+    } hidReports_e;
+
+    static constexpr size_t reportSize = 8;
+    static constexpr size_t reportLengths[reportsCount] = { 5, 7, 8 };
+
+    // Stick deflection, out of 32767, where analogModeDpad & analogModeKeys count it as a direction
+    static constexpr int16_t analogThreshold = 32767 / 3;
+
+    /// @param      keepAliveMs
+    ///             Resend an unchanged report after this long (0 to only send changes)
+    OF_HidReports(uint32_t keepAliveMs = 250) : keepAliveMs(keepAliveMs) {
+        std::memset(pending, 0, sizeof(pending));
+        std::memset(sent, 0, sizeof(sent));
+        pending[reportGamepad][6] = hatCentred;
+        std::memcpy(published, pending, sizeof(published));
+        for(int report = 0; report < reportsCount; ++report) {
+            sequence[report].store(0, std::memory_order_relaxed);
+            enabled[report] = true;
+            unsent[report] = true;
+            lastSentMs[report] = 0;
+        }
+    }
+
+    /// @brief      Bit for a button in setButtons()' mask
+    static constexpr uint16_t buttonBit(int input) { return (input >= btnFirst && input <= btnLast) ? 1 << input : 0; }
+
+    /// @brief      Sets which reports are in use, e.g. keyboard only with analogModeKeys
+    void setEnabled(int report, bool on) { enabled[report] = on; }
+
+    /// @brief      Sets pressed buttons, as a mask of buttonBit()s
+    void setButtons(uint16_t buttons) {
+        pending[reportGamepad][0] = buttons;
+        pending[reportGamepad][1] = buttons >> 8;
+        uint8_t mouse = 0;
+        for(int i = 0; i < mouseButtonsCount; ++i)
+            if(buttons & buttonBit(mouseButtons[i]))
+                mouse |= 1 << i;
+        pending[reportMouse][0] = mouse;
+    }
+
+    /// @brief      Sets the absolute pointer position, 0-32767 on each axis
+    void setPosition(uint16_t x, uint16_t y) {
+        put16(pending[reportMouse] + 1, x);
+        put16(pending[reportMouse] + 3, y);
+    }
+
+    /// @brief      Sets the analog stick, centred on 0 (+x right, +y down), as the analogMode setting wants it
+    /// @param      mode
+    ///             analogModeSettings_e
+    void setAnalog(int16_t x, int16_t y, int mode) {
+        const int dx = x > analogThreshold ? 1 : x < -analogThreshold ? -1 : 0;
+        const int dy = y > analogThreshold ? 1 : y < -analogThreshold ? -1 : 0;
+        uint8_t *gamepad = pending[reportGamepad];
+        uint8_t *keys = pending[reportKeyboard] + 2;
+
+        put16(gamepad + 2, mode == OF_Const::analogModeStick ? x : 0);
+        put16(gamepad + 4, mode == OF_Const::analogModeStick ? y : 0);
+        gamepad[6] = mode == OF_Const::analogModeDpad ? hatOf(dx, dy) : hatCentred;
+
+        std::memset(keys, 0, 6);
+        if(mode == OF_Const::analogModeKeys) {
+            int key = 0;
+            if(dx) keys[key++] = dx > 0 ? keyRight : keyLeft;
+            if(dy) keys[key++] = dy > 0 ? keyDown : keyUp;
+        }
+    }
+
+    /// @brief      Makes everything set since the last publish() available to flush(), one whole report at a time
+    /// @details    Call from the main loop after updating buttons/position/analog for this pass.
+    void publish() {
+        for(int report = 0; report < reportsCount; ++report) {
+            if(!std::memcmp(published[report], pending[report], reportSize)) continue;
+            // odd while the copy is being written
+            const uint32_t seq = sequence[report].load(std::memory_order_relaxed);
+            sequence[report].store(seq + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            std::memcpy(published[report], pending[report], reportSize);
+            std::atomic_thread_fence(std::memory_order_release);
+            sequence[report].store(seq + 2, std::memory_order_relaxed);
+        }
+    }
+
+    /// @brief      Sends whichever reports changed or are due a keep-alive; call from the USB SOF callback
+    /// @param      send
+    ///             Callable taking (int report, const uint8_t *data, size_t len), returning false if the endpoint
+    ///             is still busy - that report is then retried on the next flush(); data is only valid during the call
+    /// @return     Number of reports sent
+    template<typename Fn>
+    size_t flush(uint32_t nowMs, Fn &&send) {
+        size_t count = 0;
+        for(int report = 0; report < reportsCount; ++report) {
+            if(!enabled[report]) continue;
+
+            // take a consistent copy of the published report, or leave it for the next frame
+            uint8_t data[reportSize];
+            const uint32_t seq = sequence[report].load(std::memory_order_acquire);
+            if(seq & 1) {
+                ++interrupted;
+                continue;
+            }
+            std::memcpy(data, published[report], reportSize);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(sequence[report].load(std::memory_order_relaxed) != seq) {
+                ++interrupted;
+                continue;
+            }
+
+            const bool changed = unsent[report] || std::memcmp(data, sent[report], reportSize);
+            if(!changed && (!keepAliveMs || nowMs - lastSentMs[report] < keepAliveMs)) {
+                ++skipped;
+                continue;
+            }
+            if(!send(report, data, reportLengths[report]))
+                continue;
+            std::memcpy(sent[report], data, reportSize);
+            unsent[report] = false;
+            lastSentMs[report] = nowMs;
+            ++count;
+        }
+        reportsSent += count;
+        return count;
+    }
+
+    uint32_t reportsSent = 0;   // reports submitted
+    uint32_t skipped = 0;       // reports not sent for being unchanged
+    uint32_t interrupted = 0;   // reports put off to the next frame because publish() was mid-copy
+
+private:
+    static constexpr int btnFirst = OF_Const::btnTrigger;
+    static constexpr int btnLast = OF_Const::btnHome;
+    static_assert(btnLast - btnFirst < 16, "gamepad buttons must fit in 16 bits");
+
+    static constexpr int mouseButtonsCount = 5;
+    static constexpr int mouseButtons[mouseButtonsCount] = {
+        OF_Const::btnTrigger, OF_Const::btnGunA, OF_Const::btnGunB, OF_Const::btnGunC, OF_Const::btnStart
+    };
+
+    static constexpr uint8_t hatCentred = 8;
+    static constexpr uint8_t keyRight = 0x4F, keyLeft = 0x50, keyDown = 0x51, keyUp = 0x52;
+
+    static constexpr uint8_t hatOf(int dx, int dy) {
+        //                    dx = -1  0  +1
+        constexpr uint8_t hats[3][3] = {{ 7, 0, 1 },    // dy = -1 (up)
+                                        { 6, 8, 2 },    // dy = 0
+                                        { 5, 4, 3 }};   // dy = +1 (down)
+        return hats[dy + 1][dx + 1];
+    }
+
+    static void put16(uint8_t *out, uint16_t value) {
+        out[0] = value;
+        out[1] = value >> 8;
+    }
+
+    uint8_t pending[reportsCount][reportSize];
+    uint8_t sent[reportsCount][reportSize];
+    uint8_t published[reportsCount][reportSize];
+    std::atomic<uint32_t> sequence[reportsCount];
+    uint32_t lastSentMs[reportsCount];
+    uint32_t keepAliveMs;
+    bool enabled[reportsCount];
+    bool unsent[reportsCount];
+};
+
+#endif // _OPENFIREHID_H_
@@ -0,0 +1,161 @@
+/*!
+* @file  OpenFIREi2c.h
+* @brief Prioritised, non-blocking I2C transaction scheduling for the camera and peripheral buses
+*        of OpenFIRE microcontroller clients.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENFIREI2C_H_
+#define _OPENFIREI2C_H_
+
+#include <cstddef>
+#include <cstdint>
+
+/// @brief      One non-blocking I2C write, to be handed to the board's DMA/interrupt driven I2C driver
+typedef struct {
+    uint8_t address;
+    const uint8_t *bytes;
+    size_t len;
+} OF_I2CWrite_t;
+
+/// @brief      Write, then optionally read back, as one queued transaction
+typedef struct {
+    OF_I2CWrite_t write;
+    uint8_t *read;          // nullptr if nothing is read
+    size_t readLen;
+    uint8_t priority;       // OF_I2CScheduler::priorities_e
+} OF_I2CTransaction_t;
+
+/// @brief      Runs one I2C controller's transactions in priority order without blocking
+/// @details    Use one scheduler per controller: if the camera and peripheral buses share a controller
+///             (see OF_Const::i2cBusesShared() in the app), both submit to the same one.
+///             Camera reads always go first. Peripheral transactions (e.g. OLED spans) only start when
+///             the bus is idle and, given the camera's frame period, they should finish before the next
+///             camera read is due - so OLED traffic fills the slack instead of delaying frames.
+///             The main loop calls next() and starts what it returns; the completion interrupt calls done().
+template<size_t QueueSize = 8>
+class OF_I2CScheduler
+{
+public:
+    enum {
+        priorityCamera = 0,
+        priorityPeriph,
+        prioritiesCount
+    } priorities_e;
+
+    /// @param      busHz
+    ///             Bus clock, for estimating how long a transaction takes
+    /// @param      cameraPeriodUs
+    ///             Time between camera reads (0 if there's no camera on this controller)
+    OF_I2CScheduler(uint32_t busHz = 400000, uint32_t cameraPeriodUs = 0) : busHz(busHz), cameraPeriodUs(cameraPeriodUs) {}
+
+    /// @brief      Queues a transaction
+    /// @return     false if that priority's queue is full, or the priority isn't one of priorities_e
+    bool submit(const OF_I2CTransaction_t &transaction) {
+        if(transaction.priority >= prioritiesCount) return false;
+        queue_t &q = queues[transaction.priority];
+        if(q.count == QueueSize) return false;
+        q.items[(q.first + q.count++) % QueueSize] = transaction;
+        return true;
+    }
+
+    /// @brief      Estimated bus time for a transaction: 9 clocks per byte plus address bytes and start/stop
+    uint32_t durationUs(const OF_I2CTransaction_t &t) const {
+        const uint32_t bytes = 1 + t.write.len + (t.read ? 1 + t.readLen : 0);
+        return (uint64_t)(bytes * 9 + 4) * 1000000 / busHz;
+    }
+
+    /// @brief      Gets the next transaction to start, if the bus is free and it's allowed to run now
+    /// @return     The transaction (valid until done()), or nullptr
+    const OF_I2CTransaction_t *next(uint32_t nowUs) {
+        if(busy) return nullptr;
+        for(int priority = 0; priority < prioritiesCount; ++priority) {
+            queue_t &q = queues[priority];
+            if(!q.count) continue;
+            const OF_I2CTransaction_t &t = q.items[q.first];
+            // only hold for a camera read that's still to come - if it's overdue (e.g. the camera stopped
+            // responding and reads aren't being submitted), waiting for it would starve the peripherals
+            const uint32_t sinceCamera = nowUs - lastCameraUs;
+            if(priority != priorityCamera && cameraPeriodUs && cameraSeen && sinceCamera < cameraPeriodUs &&
+               cameraPeriodUs - sinceCamera < durationUs(t)) {
+                if(!holding) ++deferred;
+                holding = true;
+                return nullptr;
+            }
+            current = t;
+            holding = false;
+            q.first = (q.first + 1) % QueueSize;
+            --q.count;
+            if(priority == priorityCamera) {
+                lastCameraUs = nowUs;
+                cameraSeen = true;
+            }
+            busy = true;
+            startedUs = nowUs;
+            return &current;
+        }
+        return nullptr;
+    }
+
+    /// @brief      Call once the transaction from next() has finished
+    void done(uint32_t nowUs) {
+        if(!busy) return;
+        busyUs[current.priority] += nowUs - startedUs;
+        ++completed[current.priority];
+        busy = false;
+    }
+
+    /// @brief      Gets bus utilisation since the last resetStats()
+    /// @return     Share of time spent on this priority's transactions, in tenths of a percent
+    uint32_t utilisation(int priority, uint32_t nowUs) const {
+        const uint32_t elapsed = nowUs - statsSinceUs;
+        return elapsed ? (uint32_t)(busyUs[priority] * 1000 / elapsed) : 0;
+    }
+
+    void resetStats(uint32_t nowUs) {
+        for(int priority = 0; priority < prioritiesCount; ++priority) {
+            busyUs[priority] = 0;
+            completed[priority] = 0;
+        }
+        deferred = 0;
+        statsSinceUs = nowUs;
+    }
+
+    uint64_t busyUs[prioritiesCount] = {};
+    uint32_t completed[prioritiesCount] = {};
+    uint32_t deferred = 0;      // times a peripheral transaction was held back for an upcoming camera read
+
+private:
+    typedef struct {
+        OF_I2CTransaction_t items[QueueSize];
+        size_t first = 0;
+        size_t count = 0;
+    } queue_t;
+
+    queue_t queues[prioritiesCount];
+    OF_I2CTransaction_t current = {};
+    uint32_t busHz;
+    uint32_t cameraPeriodUs;
+    uint32_t lastCameraUs = 0;
+    uint32_t startedUs = 0;
+    uint32_t statsSinceUs = 0;
+    bool cameraSeen = false;
+    bool holding = false;
+    volatile bool busy = false;
+};
+
+#endif // _OPENFIREI2C_H_
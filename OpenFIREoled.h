@@ -0,0 +1,172 @@
+/*!
+* @file  OpenFIREoled.h
+* @brief Dirty-region frame model for the status OLED on the peripheral I2C bus,
+*        for OpenFIRE microcontroller clients.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENFIREOLED_H_
+#define _OPENFIREOLED_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "OpenFIREi2c.h"
+
+/// @brief      128x64 monochrome frame laid out as SSD1306 pages, tracking which columns changed
+/// @details    Drawing only marks bytes dirty if their value actually changes,
+///             so redrawing an unchanged ammo count or temperature costs a compare and nothing else.
+///             Each page (8 pixel rows) keeps one dirty column range; takeSpan() hands them out
+///             for transfer one page at a time.
+class OF_OledFrame
+{
+public:
+    static constexpr int width = 128;
+    static constexpr int height = 64;
+    static constexpr int pages = height / 8;
+
+    /// @brief      A changed column range within one page
+    typedef struct {
+        uint8_t page;
+        uint8_t first;
+        uint8_t last;
+    } span_t;
+
+    OF_OledFrame() { std::memset(buffer, 0, sizeof(buffer)); invalidate(); }
+
+    /// @brief      Marks the whole frame dirty, e.g. after the display was (re)initialised
+    void invalidate() {
+        for(int page = 0; page < pages; ++page)
+            markDirty(page, 0, width - 1);
+    }
+
+    void clear() { fillRect(0, 0, width, height, false); }
+
+    void pixel(int x, int y, bool on) {
+        if(x < 0 || x >= width || y < 0 || y >= height) return;
+        const uint8_t bit = 1 << (y & 7);
+        write(y >> 3, x, on ? (buffer[y >> 3][x] | bit) : (buffer[y >> 3][x] & ~bit));
+    }
+
+    void fillRect(int x, int y, int w, int h, bool on) {
+        for(int row = y < 0 ? 0 : y; row < y + h && row < height; ++row)
+            for(int col = x < 0 ? 0 : x; col < x + w && col < width; ++col)
+                pixel(col, row, on);
+    }
+
+    /// @brief      Writes page-aligned columns, e.g. 8px-high glyphs from a font table
+    void columns(int page, int x, const uint8_t *data, int count) {
+        if(page < 0 || page >= pages) return;
+        for(int i = 0; i < count; ++i)
+            if(x + i >= 0 && x + i < width)
+                write(page, x + i, data[i]);
+    }
+
+    bool dirty() const { return dirtyPages != 0; }
+
+    /// @brief      Takes the next page's dirty range, and marks it clean
+    /// @return     false if nothing is dirty
+    bool takeSpan(span_t &span) {
+        if(!dirtyPages) return false;
+        int page = 0;
+        while(!(dirtyPages & (1 << page))) ++page;
+        span = { (uint8_t)page, dirtyFirst[page], dirtyLast[page] };
+        dirtyPages &= ~(1 << page);
+        return true;
+    }
+
+    const uint8_t *data(const span_t &span) const { return &buffer[span.page][span.first]; }
+
+private:
+    void write(int page, int col, uint8_t value) {
+        if(buffer[page][col] == value) return;
+        buffer[page][col] = value;
+        markDirty(page, col, col);
+    }
+
+    void markDirty(int page, int first, int last) {
+        if(dirtyPages & (1 << page)) {
+            if(first < dirtyFirst[page]) dirtyFirst[page] = first;
+            if(last > dirtyLast[page]) dirtyLast[page] = last;
+        } else {
+            dirtyPages |= 1 << page;
+            dirtyFirst[page] = first;
+            dirtyLast[page] = last;
+        }
+    }
+
+    uint8_t buffer[pages][width];
+    uint8_t dirtyFirst[pages];
+    uint8_t dirtyLast[pages];
+    uint8_t dirtyPages = 0;
+};
+
+/// @brief      Sends an OF_OledFrame's changed regions to an SSD1306 in the background
+/// @details    Each dirty span becomes two I2C writes: an addressing command (column & page range),
+///             then the span's pixel data. The main loop calls next() when the bus is free and starts
+///             the returned write with DMA (or submits it to an OF_I2CScheduler at priorityPeriph);
+///             the DMA/I2C completion interrupt calls done().
+///             Nothing blocks, and drawing can continue while a span is in flight - any bytes it changes
+///             are simply sent again in a later span.
+class OF_OledRenderer
+{
+public:
+    /// @param      altAddress
+    ///             The i2cOLEDaltAddr toggle (0x3D instead of 0x3C)
+    OF_OledRenderer(bool altAddress = false) : address(altAddress ? 0x3D : 0x3C) {}
+
+    /// @brief      Gets the next write to start, if the previous one has finished and anything changed
+    /// @return     The write (valid until done() is called), or nullptr if there's nothing to send right now
+    const OF_I2CWrite_t *next() {
+        if(busy) return nullptr;
+        if(!dataPending) {
+            OF_OledFrame::span_t span;
+            if(!frame.takeSpan(span)) return nullptr;
+            const uint8_t cmd[] = { 0x00, 0x21, span.first, span.last, 0x22, span.page, span.page };
+            std::memcpy(command, cmd, sizeof(cmd));
+            payload[0] = 0x40;
+            dataLen = 1 + span.last - span.first + 1;
+            std::memcpy(payload + 1, frame.data(span), dataLen - 1);
+            current = { address, command, sizeof(cmd) };
+            dataPending = true;
+        } else {
+            current = { address, payload, dataLen };
+            dataPending = false;
+        }
+        busy = true;
+        return &current;
+    }
+
+    /// @brief      Call once the last write from next() has finished (from the completion interrupt is fine)
+    void done() { busy = false; }
+
+    /// @brief      Checks if everything drawn so far has been sent
+    bool idle() const { return !busy && !dataPending && !frame.dirty(); }
+
+    OF_OledFrame frame;
+
+private:
+    uint8_t address;
+    uint8_t command[7];
+    uint8_t payload[1 + OF_OledFrame::width];
+    size_t dataLen = 0;
+    OF_I2CWrite_t current = {};
+    volatile bool busy = false;
+    bool dataPending = false;
+};
+
+#endif // _OPENFIREOLED_H_
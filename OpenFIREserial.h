@@ -0,0 +1,130 @@
+/*!
+* @file  OpenFIREserial.h
+* @brief Shared serial frame decoder for OpenFIRE microcontroller clients and configuration apps.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _OPENFIRESERIAL_H_
+#define _OPENFIRESERIAL_H_
+
+#include <cstdint>
+
+#include "OpenFIREshared.h"
+
+/// @brief      Incremental decoder for serialCmdTypes_e frames (see OF_Const::serialLayout())
+/// @details    Bytes can be fed in whatever chunks they arrive in; each complete frame is passed to a callback.
+///             Unassigned codes (e.g. ASCII noise in 33-127) are counted and skipped one byte at a time.
+///             Frames whose payload wouldn't fit MaxPayload are dropped, and the rest of their payload is
+///             discarded unread, so the decoder never overruns and its bytes are never taken for commands.
+///             serialTerminated frames end at the next serialTerminator, which isn't passed on; one too long for
+///             MaxPayload is dropped the same way, with everything up to its terminator discarded.
+/// @note       A frame cut short can't be told apart from one still arriving - call reset() after a
+///             gap in the stream (e.g. no bytes for 100ms) so a truncated frame doesn't swallow the next one.
+template<size_t MaxPayload = 256>
+class OF_SerialDecoder
+{
+public:
+    /// @brief      Decodes a chunk of received bytes
+    /// @param      onFrame
+    ///             Callable taking (uint8_t code, const uint8_t *payload, size_t len), called once per complete frame;
+    ///             the payload is only valid during the call
+    /// @return     Number of frames completed in this chunk
+    template<typename Fn>
+    size_t feed(const uint8_t *data, size_t len, Fn &&onFrame) {
+        size_t completed = 0;
+        for(size_t i = 0; i < len; ++i) {
+            if(skip) {
+                // rest of an overlong frame's payload, which mustn't be mistaken for commands
+                const size_t n = skip < len - i ? skip : len - i;
+                skip -= n;
+                i += n - 1;
+                continue;
+            }
+            if(skipToTerminator) {
+                skipToTerminator = data[i] != OF_Const::serialTerminator;
+                continue;
+            }
+            if(!inFrame) {
+                layout = OF_Const::serialLayout(data[i]);
+                if(layout.kind == OF_Const::serialUnassigned) {
+                    ++badCodes;
+                    continue;
+                }
+                code = data[i];
+                have = 0;
+                // terminated frames aren't complete until their terminator comes in
+                need = layout.kind == OF_Const::serialTerminated ? MaxPayload + 1 : layout.head;
+                inFrame = true;
+            } else if(layout.kind == OF_Const::serialTerminated) {
+                if(data[i] == OF_Const::serialTerminator)
+                    need = have;
+                else if(have == MaxPayload) {
+                    ++overlong;
+                    skipToTerminator = true;
+                    inFrame = false;
+                    continue;
+                } else buffer[have++] = data[i];
+            } else {
+                buffer[have++] = data[i];
+                if(have == layout.head && layout.countBytes) {
+                    need = OF_Const::serialPayloadSize(layout, buffer);
+                    if(need > MaxPayload) {
+                        ++overlong;
+                        skip = need - have;
+                        inFrame = false;
+                        continue;
+                    }
+                }
+            }
+
+            if(have == need) {
+                onFrame(code, buffer, have);
+                inFrame = false;
+                ++frames;
+                ++completed;
+            }
+        }
+        return completed;
+    }
+
+    /// @brief      Drops any partly received frame
+    void reset() {
+        if(inFrame) ++truncated;
+        inFrame = false;
+        skip = 0;
+        skipToTerminator = false;
+    }
+
+    uint32_t frames = 0;        // frames decoded
+    uint32_t badCodes = 0;      // bytes skipped for not being a command code
+    uint32_t overlong = 0;      // frames dropped (and their payload skipped) for being larger than MaxPayload
+    uint32_t truncated = 0;     // frames dropped by reset() before they were complete
+
+private:
+    static_assert(MaxPayload >= OF_Const::irFrameSize, "OF_SerialDecoder payload buffer is too small for fixed frames");
+
+    uint8_t buffer[MaxPayload];
+    OF_Const::serialLayout_t layout = {};
+    uint8_t code = 0;
+    size_t have = 0;
+    size_t need = 0;
+    size_t skip = 0;            // payload bytes of an overlong frame still to discard
+    bool skipToTerminator = false; // discarding an overlong serialTerminated frame
+    bool inFrame = false;
+};
+
+#endif // _OPENFIRESERIAL_H_
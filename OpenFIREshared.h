@@ -22,10 +22,15 @@
 #ifndef _OPENFIRESHARED_H_
 #define _OPENFIRESHARED_H_
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <map>
 #include <unordered_map>
 #include <vector>
+#include <deque>
+#include <algorithm>
 
 //// BOARD IDENTIFIERS (for Desktop App identification and determining presets)
 
@@ -139,13 +144,27 @@ public:
     };
 
     // For Apps to use for lists of pin functions
-    char* boardInputs_sortedStr[boardInputsCount+1];
+    // (indexed by function + 1, i.e. in the same order as boardInputs_Descs)
+    const char* boardInputs_sortedStr[boardInputsCount+1];
 
     // Constructor
     OF_Const() {
 #ifdef OF_APP // generate strings list for the available board inputs
-        for(auto &func : boardInputs_Strings)
-            boardInputs_sortedStr[func.second+1] = (char*)func.first.data();
+        for(auto &func : boardInputs_Descs)
+            boardInputs_sortedStr[func.function+1] = func.name.data();
+
+        // decode box positions once, so board views don't have to
+        for(auto &board : boardsBoxPositions)
+            boardsBoxLayouts[board.first] = boxLayoutFrom(board.second);
+
+        // index alt presets by board; groupedByBoard() put each board's presets together, so one range covers them
+        for(size_t i = 0; i < boardsAltPresets.size(); ++i) {
+            auto range = boardsAltPresetsIndex.find(boardsAltPresets[i].board);
+            if(range == boardsAltPresetsIndex.end())
+                boardsAltPresetsIndex[boardsAltPresets[i].board] = {i, i+1};
+            else
+                ++range->second.second;
+        }
 #endif // OF_APP
     }
 
@@ -163,6 +182,7 @@ public:
         invertStaticPixels,
         i2cOLED,
         i2cOLEDaltAddr,
+        fastBoot,
         // Add here
         boolTypesCount
     } boolTypes_e;
@@ -180,6 +200,7 @@ public:
         {"InvertStaticPixels",  invertStaticPixels  },
         {"I2COLEDEnabled",      i2cOLED             },
         {"I2COLEDAltAddr",      i2cOLEDaltAddr      },
+        {"FastBoot",            fastBoot            },
     };
 
     // Variable settings indices
@@ -302,6 +323,8 @@ public:
         sCaliStart,
         sCaliSens,
         sCaliLayout,
+        sLatencyTest,       // timestamps trigger/camera/USB events until serialTerminator (see latencyStages_e)
+        sIRCapture,         // streams sIRTraceHeader, then an sIRFrameUpd per camera frame until serialTerminator
 
         // Test signals from app
         sTestSolenoid = 15,
@@ -310,9 +333,10 @@ public:
         sTestLEDG,
         sTestLEDB,
 
-        // Error types from board (with sError)
+        // Error types from board (with sError, or sErrorDetail)
         sErrCam = 0x80, // 128
         sErrPeriphGeneric,
+        // Add here, and update errorTypesCount below
 
         // Status updates from board
         sBtnPressed = 0x90, // 144
@@ -323,6 +347,14 @@ public:
         sCaliInfoUpd,
         sTestCoords,
         sCurrentProf,
+        sLoopStatsUpd,      // followed by a section count, then that many encoded timingStat_t (see timingStatsEncode)
+        sLatencyStatsUpd,   // followed by a stage count, then that many encoded timingStat_t
+        sIRTraceHeader,     // followed by an encoded irTraceHeader_t
+        sIRFrameUpd,        // followed by an encoded irFrame_t
+        sTraceDump,         // followed by the trace header and records (see traceHeaderEncode & traceRecordEncode)
+        sErrorStats,        // followed by a type count, then that many encoded errorStat_t (see errorStatsEncode)
+        sFlashStats,        // followed by flash wear totals, an op count, then that many flashOpStat_t (see flashStatsEncode)
+        sBootStats,         // followed by a phase count, then each phase's duration in us (uint32)
 
         // Push settings to board
         sCommitStart = 0xAA, // 170
@@ -332,6 +364,7 @@ public:
         sCommitProfile,
         sCommitBtns,
         sCommitID,
+        sCommitPinChanges,  // followed by a change count, then GPIO & function byte pairs (see pinsDiff)
 
         // Grab settings from board
         sGetPins = 0xC8, // 200
@@ -339,17 +372,106 @@ public:
         sGetSettings,
         sGetProfile,
         sGetBtns,
+        sGetLoopStats,      // followed by a stream interval byte in 100ms steps while in sIRTest (0 = send once)
+        sGetTrace,
+        sGetErrorStats,
+        sGetLatencyStats,
+        sGetFlashStats,     // board replies with sFlashStats, then sBootStats
 
         // for non-RP2040 boards that don't have a magic number-type reset
         sRebootToBootloader = 0xF0, // 245
 
-        sError = 0xFA, // 250
+        sError = 0xFA, // 250 - followed by the error type
+        sErrorDetail = 0xFB, // 251 - followed by the error type, then a 2-byte little-endian detail code (see errorEncode)
         sSave = 0xFC, // 252
         sClearFlash = 0xFD, // 253
         // Terminates out of any current mode, or undocks
         serialTerminator = 0xFE // 254
     } serialCmdTypes_e;
 
+    // Kinds of serialCmdTypes_e payloads, for serialLayout()
+    enum {
+        serialUnassigned = 0,   // not a command code; should be skipped as line noise
+        serialFramed,           // payload size is known from the layout (including none at all)
+        serialTerminated,       // payload runs up to the next serialTerminator, which ends the frame
+    } serialLayoutKinds_e;
+
+    /// @brief      Payload layout of a serial command
+    /// @details    The payload is head bytes, followed by a record count (read from countBytes bytes at countAt
+    ///             within the head, little-endian) times recordSize bytes.
+    typedef struct {
+        uint8_t kind;
+        uint8_t head;
+        uint8_t countAt;
+        uint8_t countBytes;
+        uint8_t recordSize;
+    } serialLayout_t;
+
+    /// @brief      Gets the payload layout of a serial command code
+    /// @details    Commands whose payload size isn't described in this file are serialTerminated: their payload
+    ///             (which may be empty) is sent as-is, followed by serialTerminator, so it can't contain that byte.
+    /// @note       New commands should be given a fixed or counted layout here when they're added above.
+    static serialLayout_t serialLayout(uint8_t code) {
+        switch(code) {
+        case sLatencyTest: case sIRCapture:
+        case sGetTrace: case sGetErrorStats: case sGetLatencyStats: case sGetFlashStats: case serialTerminator:
+            return { serialFramed, 0, 0, 0, 0 };
+        case sGetLoopStats:     return { serialFramed, 1, 0, 0, 0 };
+        case sError:            return { serialFramed, 1, 0, 0, 0 };
+        case sErrorDetail:      return { serialFramed, 3, 0, 0, 0 };
+        case sIRFrameUpd:       return { serialFramed, irFrameSize, 0, 0, 0 };
+        case sCommitPinChanges: return { serialFramed, 1, 0, 1, 2 };
+        case sLoopStatsUpd:
+        case sLatencyStatsUpd:  return { serialFramed, 1, 0, 1, timingStatSize };
+        case sErrorStats:       return { serialFramed, 1, 0, 1, errorStatSize };
+        case sFlashStats:       return { serialFramed, 13, 12, 1, flashOpStatSize };
+        case sBootStats:        return { serialFramed, 1, 0, 1, 4 };
+        case sIRTraceHeader:    return { serialFramed, 2, 1, 1, 4 };
+        case sTraceDump:        return { serialFramed, traceHeaderSize, 0, 2, traceRecordSize };
+        case sDock1: case sDock2:
+        case sIRTest: case sCaliProfile: case sCaliStart: case sCaliSens: case sCaliLayout:
+        case sTestSolenoid: case sTestRumble: case sTestLEDR: case sTestLEDG: case sTestLEDB:
+        case sBtnPressed: case sBtnReleased: case sAnalogPosUpd: case sTemperatureUpd:
+        case sCaliStageUpd: case sCaliInfoUpd: case sTestCoords: case sCurrentProf:
+        case sCommitStart: case sCommitToggles: case sCommitPins: case sCommitSettings: case sCommitProfile:
+        case sCommitBtns: case sCommitID:
+        case sGetPins: case sGetToggles: case sGetSettings: case sGetProfile: case sGetBtns:
+        case sRebootToBootloader: case sSave: case sClearFlash:
+            return { serialTerminated, 0, 0, 0, 0 };
+        default:
+            return { serialUnassigned, 0, 0, 0, 0 };
+        }
+    }
+
+    /// @brief      Gets the full payload size of a framed command, once its head has been read
+    static size_t serialPayloadSize(const serialLayout_t &layout, const uint8_t *head) {
+        size_t count = 0;
+        for(int b = 0; b < layout.countBytes; ++b)
+            count |= (size_t)head[layout.countAt + b] << (b * 8);
+        return layout.head + count * layout.recordSize;
+    }
+
+    /// @brief      Writes a serial frame: the command code, then its payload (then serialTerminator, if serialTerminated)
+    /// @param      out
+    ///             Room for len + 2 bytes
+    /// @return     Bytes written, or 0 if the payload doesn't match the command's layout
+    static size_t serialEncode(uint8_t code, const uint8_t *payload, size_t len, uint8_t *out) {
+        const serialLayout_t layout = serialLayout(code);
+        if(layout.kind == serialUnassigned || (layout.kind == serialFramed &&
+           (len < layout.head || serialPayloadSize(layout, payload) != len)))
+            return 0;
+        out[0] = code;
+        for(size_t i = 0; i < len; ++i) {
+            if(layout.kind == serialTerminated && payload[i] == serialTerminator)
+                return 0;
+            out[1+i] = payload[i];
+        }
+        if(layout.kind != serialTerminated)
+            return 1 + len;
+        out[1+len] = serialTerminator;
+        return 2 + len;
+    }
+
     enum {
         usbPID = 0,
         usbName,
@@ -471,6 +593,525 @@ public:
         /* more ESP boards should be added here */
     };
 
+    typedef struct {
+        uint8_t pin;
+        int8_t from;
+        int8_t to;
+    } pinChange_t;
+
+    /// @brief      Finds the GPIO whose function differs between two pin maps
+    /// @details    For applying a preset or alt preset on top of the current map, so that only
+    ///             the pins (and buses) that actually change need to be touched.
+    /// @param      out
+    ///             Array of at least count entries, which is filled with the changed pins in GPIO order
+    /// @return     Number of changes written to out
+    static size_t pinsDiff(const int *from, const int *to, size_t count, pinChange_t *out) {
+        size_t changes = 0;
+        for(size_t pin = 0; pin < count; ++pin)
+            if(from[pin] != to[pin])
+                out[changes++] = {(uint8_t)pin, (int8_t)from[pin], (int8_t)to[pin]};
+        return changes;
+    }
+
+    /// @brief      Checks whether a set of pin changes moves, adds or removes a given function
+    /// @details    e.g. the camera only needs restarting if camSDA or camSCL were changed.
+    static bool pinChangesAffect(const pinChange_t *changes, size_t count, int function) {
+        for(size_t i = 0; i < count; ++i)
+            if(changes[i].from == function || changes[i].to == function)
+                return true;
+        return false;
+    }
+
+    // Main loop sections timed by the board (see OF_LoopStats in OpenFIREdiag.h),
+    // in the order they're reported with sLoopStatsUpd
+    enum {
+        loopCamera = 0,
+        loopPosition,
+        loopButtons,
+        loopUSB,
+        loopFeedback,
+        // Add here
+        loopWhole,
+        loopSectionsCount
+    } loopSections_e;
+
+    // Input latency stages measured by the board in sLatencyTest mode (see OF_Latency in OpenFIREdiag.h),
+    // in the order they're reported with sLatencyStatsUpd
+    enum {
+        latencyTriggerToReport = 0, // btnTrigger GPIO edge -> HID report submitted
+        latencyFrameToPosition,     // camera frame captured -> position solved
+        latencyFrameToReport,       // camera frame captured -> HID report with that position submitted
+        // Add here
+        latencyStagesCount
+    } latencyStages_e;
+
+    /// @brief      Timing summary of one loop section or latency stage, in microseconds (saturated at 65535)
+    typedef struct {
+        uint32_t count;
+        uint16_t min;
+        uint16_t avg;
+        uint16_t p50;
+        uint16_t p99;
+        uint16_t max;
+    } timingStat_t;
+
+    static constexpr size_t timingStatSize = 14;
+
+    /// @brief      Packs timing stats for sLoopStatsUpd or sLatencyStatsUpd, little-endian in struct order
+    /// @param      out
+    ///             Buffer of at least count * timingStatSize bytes
+    /// @return     Number of bytes written
+    static size_t timingStatsEncode(const timingStat_t *stats, size_t count, uint8_t *out) {
+        uint8_t *p = out;
+        for(size_t i = 0; i < count; ++i) {
+            for(int b = 0; b < 4; ++b) *p++ = stats[i].count >> (b * 8);
+            for(uint16_t v : {stats[i].min, stats[i].avg, stats[i].p50, stats[i].p99, stats[i].max}) {
+                *p++ = v & 0xFF;
+                *p++ = v >> 8;
+            }
+        }
+        return p - out;
+    }
+
+    /// @brief      Unpacks timing stats received with sLoopStatsUpd or sLatencyStatsUpd
+    /// @return     Number of entries read (stops early if len runs out or max is reached)
+    static size_t timingStatsDecode(const uint8_t *in, size_t len, timingStat_t *out, size_t max) {
+        size_t count = 0;
+        for(; count < max && len >= timingStatSize; ++count, in += timingStatSize, len -= timingStatSize) {
+            out[count].count = in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+            out[count].min = in[4]  | (in[5] << 8);
+            out[count].avg = in[6]  | (in[7] << 8);
+            out[count].p50 = in[8]  | (in[9] << 8);
+            out[count].p99 = in[10] | (in[11] << 8);
+            out[count].max = in[12] | (in[13] << 8);
+        }
+        return count;
+    }
+
+    // Event types recorded in the board's trace ring (see OF_Trace in OpenFIREdiag.h).
+    // Host tools pair events by name: *Down/*On/*Start open a span that *Up/*Off/*End close,
+    // so keep to those suffixes when adding new ones.
+    enum {
+        traceBtnDown = 0,   // arg = boardInputs_e button
+        traceBtnUp,         // arg = boardInputs_e button
+        traceSolenoidOn,
+        traceSolenoidOff,
+        traceRumbleOn,
+        traceRumbleOff,
+        traceCamFrameStart,
+        traceCamFrameEnd,   // data = number of points seen
+        traceProfileSwitch, // arg = new profile
+        traceError,         // arg = sError type (e.g. sErrCam), data = detail code
+        traceMark,          // free for debugging, arg & data as needed
+        // Add here
+        traceEventsCount
+    } traceEvents_e;
+
+    /// @brief      One trace event, 8 bytes on the wire
+    typedef struct {
+        uint32_t time;      // microseconds since boot, wrapping
+        uint8_t event;      // traceEvents_e
+        uint8_t arg;
+        uint16_t data;
+    } traceRecord_t;
+
+    static constexpr size_t traceRecordSize = 8;
+    static constexpr size_t traceHeaderSize = 6;
+
+    /// @brief      Packs the sTraceDump header: records that follow (uint16) and records lost to overwrites (uint32)
+    static size_t traceHeaderEncode(uint16_t count, uint32_t dropped, uint8_t *out) {
+        out[0] = count & 0xFF;
+        out[1] = count >> 8;
+        for(int b = 0; b < 4; ++b) out[2+b] = dropped >> (b * 8);
+        return traceHeaderSize;
+    }
+
+    /// @brief      Packs a trace record for sTraceDump, little-endian in struct order
+    static size_t traceRecordEncode(const traceRecord_t &record, uint8_t *out) {
+        for(int b = 0; b < 4; ++b) out[b] = record.time >> (b * 8);
+        out[4] = record.event;
+        out[5] = record.arg;
+        out[6] = record.data & 0xFF;
+        out[7] = record.data >> 8;
+        return traceRecordSize;
+    }
+
+    static traceRecord_t traceRecordDecode(const uint8_t *in) {
+        return { in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24), in[4], in[5], (uint16_t)(in[6] | (in[7] << 8)) };
+    }
+
+    // Number of sError types, starting from sErrCam
+    static constexpr int errorTypesCount = sErrPeriphGeneric - sErrCam + 1;
+
+    /// @brief      Packs an error frame to send: plain sError (as every app version understands) when there's no
+    ///             detail code, else sErrorDetail
+    /// @param      out
+    ///             At least 4 bytes
+    /// @return     Number of bytes written, code included
+    static size_t errorEncode(uint8_t type, uint16_t detail, uint8_t *out) {
+        out[1] = type;
+        if(!detail) {
+            out[0] = sError;
+            return 2;
+        }
+        out[0] = sErrorDetail;
+        out[2] = detail & 0xFF;
+        out[3] = detail >> 8;
+        return 4;
+    }
+
+    /// @brief      Running totals for one sError type, as reported with sErrorStats
+    typedef struct {
+        uint8_t type;           // sErrCam, sErrPeriphGeneric...
+        uint32_t count;         // total occurrences since boot
+        uint32_t first;         // millis() of the first occurrence
+        uint32_t last;          // millis() of the latest occurrence
+        uint16_t detail;        // detail code of the latest occurrence
+        uint16_t suppressed;    // occurrences not sent as their own sError since the last sErrorStats (saturating)
+    } errorStat_t;
+
+    static constexpr size_t errorStatSize = 17;
+
+    /// @brief      Packs error stats for sErrorStats, little-endian in struct order
+    /// @return     Number of bytes written
+    static size_t errorStatsEncode(const errorStat_t *stats, size_t count, uint8_t *out) {
+        uint8_t *p = out;
+        for(size_t i = 0; i < count; ++i) {
+            *p++ = stats[i].type;
+            for(uint32_t v : {stats[i].count, stats[i].first, stats[i].last})
+                for(int b = 0; b < 4; ++b) *p++ = v >> (b * 8);
+            for(uint16_t v : {stats[i].detail, stats[i].suppressed}) {
+                *p++ = v & 0xFF;
+                *p++ = v >> 8;
+            }
+        }
+        return p - out;
+    }
+
+    /// @brief      Unpacks error stats received with sErrorStats
+    /// @return     Number of types read (stops early if len runs out or max is reached)
+    static size_t errorStatsDecode(const uint8_t *in, size_t len, errorStat_t *out, size_t max) {
+        auto u32 = [](const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); };
+        size_t count = 0;
+        for(; count < max && len >= errorStatSize; ++count, in += errorStatSize, len -= errorStatSize)
+            out[count] = { in[0], u32(in + 1), u32(in + 5), u32(in + 9),
+                           (uint16_t)(in[13] | (in[14] << 8)), (uint16_t)(in[15] | (in[16] << 8)) };
+        return count;
+    }
+
+    /// @brief      Profile the IR points were captured under, sent once at the start of an sIRCapture stream
+    /// @details    prof holds the profile's profTopOffset..profAR values, in profSyncTypes_e order.
+    typedef struct {
+        uint8_t version;
+        int32_t prof[profAR + 1];
+    } irTraceHeader_t;
+
+    /// @brief      Raw camera points of one frame, as seen before any position math
+    typedef struct {
+        uint32_t time;      // micros() at capture, wrapping
+        uint8_t seen;       // bit n set if point n was seen
+        uint16_t x[4];      // 0-1023
+        uint16_t y[4];      // 0-767
+    } irFrame_t;
+
+    static constexpr uint8_t irTraceVersion = 1;
+    static constexpr size_t irTraceHeaderSize = 2 + 4 * (profAR + 1);
+    static constexpr size_t irFrameSize = 17;
+
+    /// @brief      Saved IR traces start with these 4 bytes, then the header and frames exactly as streamed
+    static constexpr char irTraceMagic[4] = { 'O', 'F', 'I', 'R' };
+
+    /// @brief      Packs an sIRTraceHeader payload: version, profile value count, then each value as int32 LE
+    static size_t irTraceHeaderEncode(const irTraceHeader_t &header, uint8_t *out) {
+        uint8_t *p = out;
+        *p++ = header.version;
+        *p++ = profAR + 1;
+        for(int32_t v : header.prof)
+            for(int b = 0; b < 4; ++b) *p++ = (uint32_t)v >> (b * 8);
+        return p - out;
+    }
+
+    /// @return     false if the payload is too short or from a newer trace version
+    static bool irTraceHeaderDecode(const uint8_t *in, size_t len, irTraceHeader_t &header) {
+        if(len < 2 || in[0] > irTraceVersion || len < 2 + 4 * (size_t)in[1]) return false;
+        header = {};
+        header.version = in[0];
+        for(int i = 0; i < in[1] && i <= profAR; ++i)
+            header.prof[i] = (int32_t)(in[2+i*4] | (in[3+i*4] << 8) | (in[4+i*4] << 16) | ((uint32_t)in[5+i*4] << 24));
+        return true;
+    }
+
+    /// @brief      Packs an sIRFrameUpd payload: time (uint32 LE), seen mask, then four 12-bit x/y pairs in 3 bytes each
+    static size_t irFrameEncode(const irFrame_t &frame, uint8_t *out) {
+        for(int b = 0; b < 4; ++b) out[b] = frame.time >> (b * 8);
+        out[4] = frame.seen;
+        for(int i = 0; i < 4; ++i) {
+            out[5+i*3] = frame.x[i] & 0xFF;
+            out[6+i*3] = ((frame.x[i] >> 8) & 0x0F) | ((frame.y[i] & 0x0F) << 4);
+            out[7+i*3] = (frame.y[i] >> 4) & 0xFF;
+        }
+        return irFrameSize;
+    }
+
+    static irFrame_t irFrameDecode(const uint8_t *in) {
+        irFrame_t frame;
+        frame.time = in[0] | (in[1] << 8) | (in[2] << 16) | ((uint32_t)in[3] << 24);
+        frame.seen = in[4];
+        for(int i = 0; i < 4; ++i) {
+            frame.x[i] = in[5+i*3] | ((in[6+i*3] & 0x0F) << 8);
+            frame.y[i] = (in[6+i*3] >> 4) | (in[7+i*3] << 4);
+        }
+        return frame;
+    }
+
+    // Preference storage operations timed by the board (see OF_FlashStats in OpenFIREdiag.h)
+    enum {
+        flashSave = 0,  // sSave
+        flashLoad,      // loading prefs at boot
+        flashClear,     // sClearFlash
+        // Add here
+        flashOpsCount
+    } flashOps_e;
+
+    // Boot phases timed by the board, in the order they're reported with sBootStats
+    enum {
+        bootPrefsLoad = 0,
+        bootPeriphInit,
+        bootCameraInit,
+        bootUSBEnum,
+        bootConstTables,    // constructing OF_Const (skipped on fast boot)
+        bootPinsInit,       // setting up every mapped pin (only critical ones on fast boot)
+        bootDeferredInit,   // OLED, NeoPixels & other non-critical peripherals, after the gun is live
+        bootToLive,         // reset -> trigger & camera live; only needs ending, as it counts from reset
+        // Add here
+        bootPhasesCount
+    } bootPhases_e;
+
+    /// @brief      Totals for one flashOps_e operation since boot
+    typedef struct {
+        uint32_t count;
+        uint32_t lastUs;
+        uint32_t maxUs;
+        uint32_t totalMs;
+    } flashOpStat_t;
+
+    /// @brief      Flash wear totals since boot, plus each operation's timing
+    typedef struct {
+        uint32_t erases;        // sectors erased
+        uint32_t programs;      // pages programmed
+        uint32_t bytesWritten;
+        flashOpStat_t ops[flashOpsCount];
+    } flashStats_t;
+
+    static constexpr size_t flashOpStatSize = 16;
+    static constexpr size_t flashStatsSize = 13 + flashOpsCount * flashOpStatSize;
+
+    /// @brief      Packs the sFlashStats payload: erases, programs and bytes written (uint32 LE each),
+    ///             op count, then each op's count, last, max and total time (uint32 LE each)
+    /// @return     Number of bytes written (flashStatsSize)
+    static size_t flashStatsEncode(const flashStats_t &stats, uint8_t *out) {
+        uint8_t *p = out;
+        auto u32 = [&p](uint32_t v) { for(int b = 0; b < 4; ++b) *p++ = v >> (b * 8); };
+        u32(stats.erases);
+        u32(stats.programs);
+        u32(stats.bytesWritten);
+        *p++ = flashOpsCount;
+        for(auto &op : stats.ops) {
+            u32(op.count);
+            u32(op.lastUs);
+            u32(op.maxUs);
+            u32(op.totalMs);
+        }
+        return p - out;
+    }
+
+    /// @brief      Unpacks an sFlashStats payload; ops the sender didn't report are left zeroed
+    /// @return     false if the payload is too short
+    static bool flashStatsDecode(const uint8_t *in, size_t len, flashStats_t &stats) {
+        auto u32 = [](const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); };
+        if(len < 13 || len < 13 + (size_t)in[12] * flashOpStatSize) return false;
+        stats = {};
+        stats.erases = u32(in);
+        stats.programs = u32(in + 4);
+        stats.bytesWritten = u32(in + 8);
+        for(int i = 0; i < in[12] && i < flashOpsCount; ++i) {
+            const uint8_t *op = in + 13 + i * flashOpStatSize;
+            stats.ops[i] = { u32(op), u32(op + 4), u32(op + 8), u32(op + 12) };
+        }
+        return true;
+    }
+
+    /// @brief      Checks if a pin function can be set up after the gun is live
+    /// @details    Everything needed to aim and shoot (buttons, camera, solenoid) is critical;
+    ///             LEDs, NeoPixels, the peripheral bus (OLED), rumble, analog stick and temp sensor can wait.
+    static constexpr bool bootDeferrable(int function) {
+        return function == neoPixel || function == ledR || function == ledG || function == ledB ||
+               function == periphSDA || function == periphSCL || function == analogX || function == analogY ||
+               function == tempPin || function == rumblePin || function == rumbleSwitch;
+    }
+
+    /// @brief      FNV-1a hash of a board name, for telling snapshots from different boards apart
+    static constexpr uint32_t boardHash(std::string_view board) {
+        uint32_t hash = 2166136261u;
+        for(char c : board)
+            hash = (hash ^ (uint8_t)c) * 16777619u;
+        return hash;
+    }
+
+    static uint32_t crc32(const uint8_t *data, size_t len) {
+        uint32_t crc = 0xFFFFFFFF;
+        for(size_t i = 0; i < len; ++i) {
+            crc ^= data[i];
+            for(int b = 0; b < 8; ++b)
+                crc = (crc >> 1) ^ (0xEDB88320 & -(crc & 1));
+        }
+        return ~crc;
+    }
+
+    static constexpr uint32_t bootSnapshotMagic = 0x5342464F; // "OFBS"
+    static constexpr uint8_t bootSnapshotVersion = 1;
+    static constexpr int bootSnapshotPins = 49; // enough for the largest board (ESP32-S3)
+
+    /// @brief      Resolved pin setup, saved alongside the prefs for fastBoot
+    /// @details    Holds the pin map already validated and split into the pins to set up before the gun goes live
+    ///             and those that can wait (see bootDeferrable()), so a fast boot can skip constructing OF_Const
+    ///             and checking the map, and go straight to critical pins, camera and USB.
+    ///             Rebuild it whenever the pin map is saved; a snapshot that fails bootSnapshotValid() should be
+    ///             ignored in favour of the normal boot path.
+    typedef struct {
+        uint32_t magic;
+        uint8_t version;
+        uint8_t pinsCount;
+        uint8_t criticalCount;
+        uint8_t deferredCount;
+        uint32_t boardHash;                 // boardHash(OPENFIRE_BOARD)
+        int8_t pins[bootSnapshotPins];      // function of each GPIO
+        uint8_t critical[bootSnapshotPins]; // GPIOs to set up before going live, in GPIO order
+        uint8_t deferred[bootSnapshotPins]; // GPIOs to set up afterwards
+        uint8_t reserved;                   // keeps crc aligned without padding, so it covers every byte
+        uint32_t crc;                       // crc32 of everything above
+    } bootSnapshot_t;
+
+    /// @brief      Validates a pin map and builds its boot snapshot
+    /// @details    The map is rejected if it's larger than bootSnapshotPins, has an unknown function,
+    ///             maps any function to more than one GPIO, or has only one of camSDA & camSCL.
+    /// @return     false if the map isn't valid (out is left untouched)
+    static bool bootSnapshotBuild(const int *pins, size_t count, std::string_view board, bootSnapshot_t &out) {
+        if(count > (size_t)bootSnapshotPins) return false;
+        bool used[boardInputsCount] = {};
+        for(size_t pin = 0; pin < count; ++pin) {
+            if(pins[pin] < unavailable || pins[pin] >= boardInputsCount) return false;
+            if(pins[pin] >= 0) {
+                if(used[pins[pin]]) return false;
+                used[pins[pin]] = true;
+            }
+        }
+        if(used[camSDA] != used[camSCL]) return false;
+
+        bootSnapshot_t snapshot = {};
+        snapshot.magic = bootSnapshotMagic;
+        snapshot.version = bootSnapshotVersion;
+        snapshot.pinsCount = count;
+        snapshot.boardHash = boardHash(board);
+        for(size_t pin = 0; pin < count; ++pin) {
+            snapshot.pins[pin] = pins[pin];
+            if(pins[pin] < 0) continue;
+            if(bootDeferrable(pins[pin]))
+                snapshot.deferred[snapshot.deferredCount++] = pin;
+            else
+                snapshot.critical[snapshot.criticalCount++] = pin;
+        }
+        snapshot.crc = crc32((const uint8_t*)&snapshot, offsetof(bootSnapshot_t, crc));
+        out = snapshot;
+        return true;
+    }
+
+    static_assert(offsetof(bootSnapshot_t, crc) == 12 + 3 * bootSnapshotPins + 1, "bootSnapshot_t must not have padding");
+
+    /// @brief      Checks a snapshot read back from flash before fast-booting from it
+    static bool bootSnapshotValid(const bootSnapshot_t &snapshot, std::string_view board) {
+        return snapshot.magic == bootSnapshotMagic && snapshot.version == bootSnapshotVersion &&
+               snapshot.boardHash == boardHash(board) && snapshot.pinsCount <= bootSnapshotPins &&
+               snapshot.criticalCount + snapshot.deferredCount <= snapshot.pinsCount &&
+               snapshot.crc == crc32((const uint8_t*)&snapshot, offsetof(bootSnapshot_t, crc));
+    }
+
+    /// @brief      Clock fed to a Wii-style IR camera from the wiiClockGen pin
+    static constexpr uint32_t wiiCamClockHz = 25000000;
+
+    /// @brief      Hardware clock output settings for wiiClockGen
+    /// @details    Computed once when the pin map is applied, and loaded straight into the peripheral before camera init:
+    ///             on RP2040/RP2350 a PWM slice (clock divider, wrap = period - 1, channel level),
+    ///             on ESP32-S3 an LEDC timer & channel (clock divider, resolution = log2(period), duty = level).
+    ///             After that the clock runs entirely in hardware.
+    typedef struct {
+        uint32_t divider;   // fixed point: 4 fractional bits on RP PWM, 8 on ESP32 LEDC
+        uint32_t period;    // counter ticks per output cycle
+        uint32_t level;     // ticks high per cycle
+        uint32_t hz;        // frequency actually produced, or 0 if the target can't be reached
+        bool fractional;    // no integer divider gets there, so the period dithers - worth warning about
+    } clockGen_t;
+
+    /// @brief      Searches for the divider & period closest to a target frequency
+    /// @details    Fractional dividers dither the period from cycle to cycle, so an integer divider is
+    ///             preferred whenever it's just as close.
+    /// @param      maxDivider
+    ///             Largest divider, in the same fixed point as fracBits
+    /// @param      periodFor
+    ///             Maps a step number (from 0) to the period to try, increasing; 0 ends the search
+    template<typename Fn>
+    static constexpr clockGen_t clockGenSearch(uint32_t srcHz, uint32_t targetHz, int fracBits, uint32_t maxDivider, Fn periodFor) {
+        clockGen_t best = {};
+        uint64_t bestError = UINT64_MAX;
+        const uint32_t one = 1u << fracBits;
+        for(uint32_t step = 0, period = 0; targetHz && (period = periodFor(step)); ++step) {
+            const uint64_t divisor = (uint64_t)targetHz * period;
+            const uint64_t divider = (((uint64_t)srcHz << fracBits) + divisor / 2) / divisor;
+            if(divider < one) break;
+            if(divider > maxDivider) continue;
+            // compared in mHz, so near misses aren't rounded into exact matches
+            const uint64_t mHz = ((uint64_t)srcHz << fracBits) * 1000 / (divider * period);
+            const uint64_t error = mHz > targetHz * 1000ull ? mHz - targetHz * 1000ull : targetHz * 1000ull - mHz;
+            const bool integer = !(divider & (one - 1));
+            if(error < bestError || (error == bestError && integer && (best.divider & (one - 1)))) {
+                best = { (uint32_t)divider, period, period / 2, (uint32_t)((mHz + 500) / 1000), !integer };
+                bestError = error;
+            }
+            if(integer && ((uint64_t)srcHz << fracBits) == divider * divisor) break;
+        }
+        return best;
+    }
+
+    /// @brief      RP2040/RP2350 PWM slice settings for a clock (divider 1.0-255.9375 in 1/16ths, period up to 65536)
+    /// @param      sysHz
+    ///             System clock, e.g. 125MHz (RP2040) or 150MHz (RP2350)
+    static constexpr clockGen_t rpPwmClock(uint32_t sysHz, uint32_t targetHz = wiiCamClockHz) {
+        return clockGenSearch(sysHz, targetHz, 4, 255*16 + 15, [](uint32_t step) { return step < 65535 ? step + 2 : 0; });
+    }
+
+    /// @brief      ESP32-S3 LEDC settings for a clock (divider 1.0-1023.996 in 1/256ths, 1-14 bit resolution)
+    /// @note       None of the LEDC's clock sources (80MHz APB, 40MHz XTAL, 17.5MHz RC_FAST) divides down to
+    ///             wiiCamClockHz by a whole number, so the default result is fractional (80MHz / (410/256) / 2,
+    ///             about 24.976MHz) with fractional set. The board should warn about the added jitter, or give the
+    ///             camera its own oscillator.
+    /// @param      srcHz
+    ///             LEDC timer clock, i.e. 80MHz APB
+    static constexpr clockGen_t espLedcClock(uint32_t srcHz = 80000000, uint32_t targetHz = wiiCamClockHz) {
+        return clockGenSearch(srcHz, targetHz, 8, (1u << 18) - 1, [](uint32_t step) { return step < 14 ? 2u << step : 0; });
+    }
+
+    /// @brief      PWM slice a GPIO belongs to on RP2040/RP2350 (channel A/B is gpio & 1)
+    /// @details    Both channels of a slice share its divider and wrap, so nothing else on that slice can use PWM
+    ///             once it's generating the camera clock.
+    static constexpr int rpPwmSlice(int gpio) {
+        return gpio < 32 ? (gpio >> 1) & 7 : 8 + ((gpio >> 1) & 3);
+    }
+
+    /// @brief      Checks if a pin function may be driven with PWM (analogWrite) by the board
+    static constexpr bool pwmFunction(int function) {
+        return function == rumblePin || function == solenoidPin || function == ledR || function == ledG || function == ledB;
+    }
+
     static const unsigned int TEMPERATURE_SENSOR_ERROR_VALUE = 125; // ADC reading indicating sensor fault / disconnection.
 
 // Only needed for the Desktop App, don't build for microcontroller firmware!
@@ -492,6 +1133,39 @@ public:
         {"generic",                 "Unknown RP2040 Board"}
     };
 
+    // Display names for the board's diagnostics enums; the board itself only sends indices
+    const std::unordered_map<std::string_view, int> loopSections_Strings = {
+        {"Camera",      loopCamera      },
+        {"Position",    loopPosition    },
+        {"Buttons",     loopButtons     },
+        {"USB",         loopUSB         },
+        {"Feedback",    loopFeedback    },
+        {"Loop",        loopWhole       },
+    };
+
+    const std::unordered_map<std::string_view, int> latencyStages_Strings = {
+        {"TriggerToReport", latencyTriggerToReport  },
+        {"FrameToPosition", latencyFrameToPosition  },
+        {"FrameToReport",   latencyFrameToReport    },
+    };
+
+    const std::unordered_map<std::string_view, int> flashOps_Strings = {
+        {"Save",    flashSave   },
+        {"Load",    flashLoad   },
+        {"Clear",   flashClear  },
+    };
+
+    const std::unordered_map<std::string_view, int> bootPhases_Strings = {
+        {"PrefsLoad",   bootPrefsLoad   },
+        {"PeriphInit",  bootPeriphInit  },
+        {"CameraInit",  bootCameraInit  },
+        {"USBEnum",     bootUSBEnum     },
+        {"ConstTables", bootConstTables },
+        {"PinsInit",    bootPinsInit    },
+        {"DeferredInit",bootDeferredInit},
+        {"ToLive",      bootToLive      },
+    };
+
     /// @brief      Types of board architectures
     /// @details    Board archs are to be dictated by the application on a per-board basis,
     ///             to be used for defining which pins are capable of what.
@@ -540,6 +1214,100 @@ public:
         pinIsSPI1   = 1 << 4
     } pinCapabilities_e;
 
+    /// @brief      Indices to be used as a bitmap for what a pin needs to be capable of for a function
+    enum {
+        needsNothing = 0,
+        needsADC     = 1 << 0,
+        needsI2CSDA  = 1 << 1,
+        needsI2CSCL  = 1 << 2,
+    } pinRequirements_e;
+
+    /// @brief      Checks a pin's capabilities (from mcuCapableMaps) against a function's requirements
+    static constexpr bool pinMeets(int capabilities, int needs) {
+        if((needs & needsADC) && !(capabilities & pinHasADC))
+            return false;
+        if(needs & (needsI2CSDA | needsI2CSCL)) {
+            if(capabilities & pinAnyI2C)
+                return true;
+            if(!(capabilities & pinCanI2C) || (bool)(capabilities & pinIsI2CSCL) != (bool)(needs & needsI2CSCL))
+                return false;
+        }
+        return true;
+    }
+
+    /// @brief      Gets which hardware I2C controller a pin's capabilities tie it to
+    /// @return     0 or 1, or -1 if the pin can't do I2C or can be routed to either controller (pinAnyI2C)
+    static constexpr int pinI2CController(int capabilities) {
+        if((capabilities & pinAnyI2C) || !(capabilities & pinCanI2C))
+            return -1;
+        return (capabilities & pinIsI2C1) ? 1 : 0;
+    }
+
+    typedef struct {
+        std::string_view name;
+        int function;
+        int needs;
+    } boardInputDesc_t;
+
+    /// @brief      Pin functions in display order, i.e. boardInputs_Descs[function+1] describes function
+    /// @details    Names match boardInputs_Strings; needs is a pinRequirements_e bitmap.
+    static constexpr boardInputDesc_t boardInputs_Descs[boardInputsCount+1] = {
+        {"Unmapped",            btnUnmapped,        needsNothing    },
+        {"Trigger",             btnTrigger,         needsNothing    },
+        {"Button A",            btnGunA,            needsNothing    },
+        {"Button B",            btnGunB,            needsNothing    },
+        {"Start",               btnStart,           needsNothing    },
+        {"Select",              btnSelect,          needsNothing    },
+        {"Button C",            btnGunC,            needsNothing    },
+        {"D-Pad Up",            btnGunUp,           needsNothing    },
+        {"D-Pad Down",          btnGunDown,         needsNothing    },
+        {"D-Pad Left",          btnGunLeft,         needsNothing    },
+        {"D-Pad Right",         btnGunRight,        needsNothing    },
+        {"Pedal",               btnPedal,           needsNothing    },
+        {"Alt Pedal",           btnPedal2,          needsNothing    },
+        {"Pump Action",         btnPump,            needsNothing    },
+        {"Home Button",         btnHome,            needsNothing    },
+        {"Rumble Signal",       rumblePin,          needsNothing    },
+        {"Solenoid Signal",     solenoidPin,        needsNothing    },
+        {"Rumble Switch",       rumbleSwitch,       needsNothing    },
+        {"Solenoid Switch",     solenoidSwitch,     needsNothing    },
+        {"Autofire Switch",     autofireSwitch,     needsNothing    },
+        {"External NeoPixel",   neoPixel,           needsNothing    },
+        {"RGB LED Red",         ledR,               needsNothing    },
+        {"RGB LED Green",       ledG,               needsNothing    },
+        {"RGB LED Blue",        ledB,               needsNothing    },
+        {"Wii Cam Clock",       wiiClockGen,        needsNothing    },
+        {"Camera SDA",          camSDA,             needsI2CSDA     },
+        {"Camera SCL",          camSCL,             needsI2CSCL     },
+        {"Peripherals SDA",     periphSDA,          needsI2CSDA     },
+        {"Peripherals SCL",     periphSCL,          needsI2CSCL     },
+        {"Analog Stick X",      analogX,            needsADC        },
+        {"Analog Stick Y",      analogY,            needsADC        },
+        {"Temperature Sensor",  tempPin,            needsADC        },
+    };
+
+    // Checked and sorted with lambdas, as static member functions can't be used in constant expressions until the class is complete
+    static_assert([] {
+        for(int i = 0; i <= boardInputsCount; ++i)
+            if(boardInputs_Descs[i].function != i-1)
+                return false;
+        return true;
+    }(), "boardInputs_Descs must list every function in enum order");
+
+    /// @brief      Indices into boardInputs_Descs, sorted alphabetically by name
+    static constexpr std::array<uint8_t, boardInputsCount+1> boardInputs_Alphabetical = [] {
+        std::array<uint8_t, boardInputsCount+1> order {};
+        for(size_t i = 0; i < order.size(); ++i)
+            order[i] = i;
+        for(size_t i = 1; i < order.size(); ++i)
+            for(size_t j = i; j > 0 && boardInputs_Descs[order[j]].name < boardInputs_Descs[order[j-1]].name; --j) {
+                const uint8_t tmp = order[j];
+                order[j] = order[j-1];
+                order[j-1] = tmp;
+            }
+        return order;
+    }();
+
     /// @brief      Map of capabilities of each pin for a board type
     /// @details    Dictates what types of functions a pin can be mapped to, based on its capabilities
     ///             This applies to ALL boards using a specific architecture.
@@ -603,6 +1371,126 @@ public:
                                  /*25*/ pinDigital,                 pinI2C1SDA | pinSPI1SCK | pinHasADC,    pinI2C1SCL | pinSPI1TX | pinHasADC,     pinSPI1RX  | pinHasADC,                 pinDigital                  }},
         };
 
+    /// @brief      Checks whether a function is set in a pinsAllowedFunctions() bitmap
+    static constexpr bool functionAllowed(uint64_t allowed, int function) {
+        return (allowed >> (function+1)) & 1;
+    }
+
+    /// @brief      Gets which functions each GPIO of a board can be mapped to
+    /// @details    Each GPIO gets a bitmap where bit (function+1) is set if that function is allowed on it
+    ///             (see functionAllowed()), based on the board's entry in mcuCapableMaps if it has one,
+    ///             else its architecture's. Pins that are unavailable in boardsPresetsMap allow nothing.
+    ///             Results are generated on first use and cached per board & arch, so switching boards back
+    ///             and forth costs nothing after the first time. The cache is permanent - entries are never
+    ///             evicted or invalidated - so it only takes boards in boardsPresetsMap and archs in boardArchs,
+    ///             which keeps it bounded however many names are looked up.
+    /// @param      board
+    ///             Board name as reported by OPENFIRE_BOARD
+    /// @param      arch
+    ///             Board's architecture, from boardArchs
+    /// @return     Bitmap per GPIO, valid for as long as this OF_Const; empty for an unknown board or arch
+    /// @note       Not thread-safe: the cache is filled in on first use, even through a const OF_Const.
+    const std::vector<uint64_t> &pinsAllowedFunctions(std::string_view board, std::string_view arch) const {
+        static const std::vector<uint64_t> unknown;
+        auto preset = boardsPresetsMap.find(board);
+        if(preset == boardsPresetsMap.end() ||
+           std::find(std::begin(boardArchs), std::end(boardArchs), arch) == std::end(boardArchs))
+            return unknown;
+
+        auto byBoard = allowedFunctions.find(board);
+        if(byBoard == allowedFunctions.end())
+            byBoard = allowedFunctions.emplace(std::string(board), std::map<std::string, std::vector<uint64_t>, std::less<>>()).first;
+        auto cached = byBoard->second.find(arch);
+        if(cached != byBoard->second.end())
+            return cached->second;
+
+        std::vector<uint64_t> &allowed = byBoard->second[std::string(arch)];
+
+        auto caps = mcuCapableMaps.find(board);
+        if(caps == mcuCapableMaps.end())
+            caps = mcuCapableMaps.find(arch);
+
+        const size_t pins = preset->second.size();
+        allowed.resize(pins, 0);
+        for(size_t pin = 0; pin < pins; ++pin) {
+            if(preset->second[pin] == unavailable)
+                continue;
+            const int capabilities = (caps != mcuCapableMaps.end() && pin < caps->second.size()) ? caps->second[pin] : pinDigital;
+            for(auto &func : boardInputs_Descs)
+                if(pinMeets(capabilities, func.needs))
+                    allowed[pin] |= (uint64_t)1 << (func.function+1);
+        }
+        return allowed;
+    }
+
+    /// @brief      Checks if a pin map puts the camera and peripheral buses on the same I2C controller
+    /// @details    When they share one, the board has to interleave OLED/peripheral traffic with camera reads
+    ///             (see OF_I2CScheduler), which costs frame time - worth warning about when the map is set.
+    ///             Boards that can route any pin to either controller (pinAnyI2C) never have to share.
+    /// @param      pinMap
+    ///             Function per GPIO, as in boardsPresetsMap
+    /// @return     true if both buses are mapped and land on the same controller
+    bool i2cBusesShared(const std::vector<int> &pinMap, std::string_view board, std::string_view arch) const {
+        auto caps = mcuCapableMaps.find(board);
+        if(caps == mcuCapableMaps.end())
+            caps = mcuCapableMaps.find(arch);
+        if(caps == mcuCapableMaps.end())
+            return false;
+
+        int cam = -1, periph = -1;
+        for(size_t pin = 0; pin < pinMap.size() && pin < caps->second.size(); ++pin) {
+            if(pinMap[pin] == camSDA)
+                cam = pinI2CController(caps->second[pin]);
+            else if(pinMap[pin] == periphSDA)
+                periph = pinI2CController(caps->second[pin]);
+        }
+        return cam >= 0 && cam == periph;
+    }
+
+    /// @brief      Checks that wiiClockGen, if mapped, can get a hardware clock output to itself
+    /// @details    The pin has to exist in the board's mcuCapableMaps entry, and be allowed to take wiiClockGen
+    ///             by pinsAllowedFunctions() (so not unavailable in boardsPresetsMap). On RP boards, its PWM slice
+    ///             (see rpPwmSlice()) also can't be shared with another PWM function, since the clock takes over
+    ///             the slice's divider and wrap. ESP32-S3 boards give the clock its own LEDC timer, so don't conflict.
+    /// @param      pinMap
+    ///             Function per GPIO, as in boardsPresetsMap
+    /// @param      conflict
+    ///             If not null, set to the GPIO that conflicts with the clock (or the clock pin itself if it's invalid), else -1
+    /// @return     true if there's no clock pin, or it can be used
+    bool clockGenValid(const std::vector<int> &pinMap, std::string_view board, std::string_view arch, int *conflict = nullptr) const {
+        if(conflict) *conflict = -1;
+        int clockPin = -1;
+        for(size_t pin = 0; pin < pinMap.size(); ++pin)
+            if(pinMap[pin] == wiiClockGen)
+                clockPin = pin;
+        if(clockPin < 0)
+            return true;
+
+        auto caps = mcuCapableMaps.find(board);
+        if(caps == mcuCapableMaps.end())
+            caps = mcuCapableMaps.find(arch);
+        const std::vector<uint64_t> &allowed = pinsAllowedFunctions(board, arch);
+        if(caps == mcuCapableMaps.end() || (size_t)clockPin >= caps->second.size() ||
+           (size_t)clockPin >= allowed.size() || !functionAllowed(allowed[clockPin], wiiClockGen)) {
+            if(conflict) *conflict = clockPin;
+            return false;
+        }
+
+        if(arch == boardArchs[boardRP])
+            for(size_t pin = 0; pin < pinMap.size(); ++pin)
+                if(pwmFunction(pinMap[pin]) && rpPwmSlice(pin) == rpPwmSlice(clockPin)) {
+                    if(conflict) *conflict = pin;
+                    return false;
+                }
+        return true;
+    }
+
+private:
+    // pinsAllowedFunctions() results, by board then arch
+    mutable std::map<std::string, std::map<std::string, std::vector<uint64_t>, std::less<>>, std::less<>> allowedFunctions;
+
+public:
+
     enum {
         posNothing  = 0,
         posLeft     = 0b00000001 << 8,
@@ -751,53 +1639,197 @@ public:
     };
 
     typedef struct {
+        unsigned int slot;
+        int pin;
+    } boardBoxSlot_t;
+
+    /// @brief      Ready-to-render layout of a board's pins, one list per side
+    /// @details    Each list is sorted by slot, and posNothing pins are left out.
+    typedef struct {
+        std::vector<boardBoxSlot_t> left;
+        std::vector<boardBoxSlot_t> right;
+        std::vector<boardBoxSlot_t> middle;
+    } boardBoxLayout_t;
+
+    /// @brief      Map of decoded boardsBoxPositions, generated once on construction
+    /// @details    Key = board, same as boardsBoxPositions.
+    std::unordered_map<std::string_view, boardBoxLayout_t> boardsBoxLayouts;
+
+    /// @brief      Splits a board's bitpacked box positions into per-side lists sorted by slot
+    static boardBoxLayout_t boxLayoutFrom(const std::vector<unsigned int> &positions) {
+        boardBoxLayout_t layout;
+        for(unsigned int pin = 0; pin < positions.size(); ++pin) {
+            const unsigned int slot = positions[pin] & ~posCheck;
+            switch(positions[pin] & posCheck) {
+            case posLeft:   layout.left.push_back({slot, (int)pin});   break;
+            case posRight:  layout.right.push_back({slot, (int)pin});  break;
+            case posMiddle: layout.middle.push_back({slot, (int)pin}); break;
+            default: break;
+            }
+        }
+        for(auto side : {&layout.left, &layout.right, &layout.middle})
+            std::stable_sort(side->begin(), side->end(),
+                             [](const boardBoxSlot_t &a, const boardBoxSlot_t &b) { return a.slot < b.slot; });
+        return layout;
+    }
+
+    /// @brief      Checks boardsBoxPositions for layout mistakes
+    /// @details    Reports pins sharing a slot on the same side, pins with more than one side set,
+    ///             pins with a slot but no side (or a side but no slot), boards whose pin count doesn't match
+    ///             boardsPresetsMap, and boards in boardsPresetsMap that have no box positions at all.
+    /// @return     One line per problem found; empty if the positions are all valid
+    std::vector<std::string> boxPositionsErrors() const {
+        std::vector<std::string> errors;
+        for(auto &preset : boardsPresetsMap)
+            if(!boardsBoxPositions.count(preset.first))
+                errors.push_back(std::string(preset.first) + ": in boardsPresetsMap, but has no box positions");
+
+        for(auto &board : boardsBoxPositions) {
+            const std::string name(board.first);
+            auto preset = boardsPresetsMap.find(board.first);
+            if(preset != boardsPresetsMap.end() && preset->second.size() != board.second.size())
+                errors.push_back(name + ": " + std::to_string(board.second.size()) + " box positions, but " +
+                                 std::to_string(preset->second.size()) + " pins in boardsPresetsMap");
+
+            for(unsigned int pin = 0; pin < board.second.size(); ++pin) {
+                const unsigned int side = board.second[pin] & posCheck;
+                if(side && side != posLeft && side != posRight && side != posMiddle)
+                    errors.push_back(name + ": GPIO " + std::to_string(pin) + " is set to more than one side");
+                else if(side && !(board.second[pin] & ~posCheck))
+                    errors.push_back(name + ": GPIO " + std::to_string(pin) + " has no slot number");
+                else if(!side && (board.second[pin] & ~posCheck))
+                    errors.push_back(name + ": GPIO " + std::to_string(pin) + " has a slot number but no side");
+            }
+
+            const boardBoxLayout_t layout = boxLayoutFrom(board.second);
+            for(auto side : {&layout.left, &layout.right, &layout.middle})
+                for(size_t i = 1; i < side->size(); ++i)
+                    if((*side)[i].slot == (*side)[i-1].slot)
+                        errors.push_back(name + ": GPIO " + std::to_string((*side)[i-1].pin) + " and " +
+                                         std::to_string((*side)[i].pin) + " share slot " + std::to_string((*side)[i].slot));
+        }
+        return errors;
+    }
+
+    typedef struct {
+        std::string_view board;
         const char * name;
         std::vector<int> pin;
     } boardAltPresetsMap_t;
 
-    /// @brief      MultiMap of alternative pin mappings for supported boards to show in the application.
-    /// @details    Key = board (one board can be multiple), string literal label, int array maps to RP2040 GPIO where each value is a FW function (or unmapped).
-    const std::unordered_multimap<std::string_view, boardAltPresetsMap_t> boardsAltPresets = {
+    /// @brief      Stable-sorts presets by board, so each board's presets are together and in their listed order
+    static std::vector<boardAltPresetsMap_t> groupedByBoard(std::vector<boardAltPresetsMap_t> presets) {
+        std::stable_sort(presets.begin(), presets.end(),
+                         [](const boardAltPresetsMap_t &a, const boardAltPresetsMap_t &b) { return a.board < b.board; });
+        return presets;
+    }
+
+    /// @brief      List of alternative pin mappings for supported boards to show in the application.
+    /// @details    Board (one board can be listed multiple times), string literal label, int array maps to RP2040 GPIO where each value is a FW function (or unmapped).
+    ///             A board's presets are offered in the order they're listed here; they're grouped by board
+    ///             on construction, so they don't have to be listed together.
+    const std::vector<boardAltPresetsMap_t> boardsAltPresets = groupedByBoard({
         //=====================================================================================================
         // Raspberry Pi Pico Presets (currently a test)
         // Notes: rpi boards do not expose pins 23-25; pin 29/A3 is used for builtin chipset temp monitor
         /*
-        {"rpipico",                 {"Test",
+        {"rpipico",                 "Test",
                                     {   btnPump,       btnPedal,       btnUnmapped,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   btnUnmapped,    btnUnmapped,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   btnUnmapped,    btnUnmapped,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   btnUnmapped,    btnUnmapped,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   btnUnmapped,    btnUnmapped,    unavailable,    unavailable,
-                                        unavailable,   btnUnmapped,    btnUnmapped,    btnUnmapped,    unavailable}}},
+                                        unavailable,   btnUnmapped,    btnUnmapped,    btnUnmapped,    unavailable}},
 
-        {"rpipico",                 {"Test 2",
+        {"rpipico",                 "Test 2",
                                     {   btnGunA,       btnTrigger,     btnUnmapped,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   btnUnmapped,    btnUnmapped,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   btnUnmapped,    btnUnmapped,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   btnUnmapped,    btnUnmapped,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   btnUnmapped,    btnUnmapped,    unavailable,    unavailable,
-                                        unavailable,   btnUnmapped,    btnUnmapped,    btnUnmapped,    unavailable}}},
+                                        unavailable,   btnUnmapped,    btnUnmapped,    btnUnmapped,    unavailable}},
         */
 
         //=====================================================================================================
         // Adafruit ItsyBitsy RP2040 Presets
         // Notes: pins 13-17 & 21-23 are unexposed
-        {"adafruitItsyRP2040",      {"SAMCO 2.0 (Btn C as Home)",
+        {"adafruitItsyRP2040",      "SAMCO 2.0 (Btn C as Home)",
                                     {   btnUnmapped,   btnUnmapped,    camSDA,         camSCL,         btnPedal,
                                         btnUnmapped,   btnTrigger,     btnGunDown,     btnGunLeft,     btnGunUp,
                                         btnGunRight,   btnHome,        btnUnmapped,    unavailable,    unavailable,
                                         unavailable,   unavailable,    unavailable,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   unavailable,    unavailable,    unavailable,    rumblePin,
-                                        solenoidPin,   btnGunB,        btnGunA,        btnStart,       btnSelect}}},
+                                        solenoidPin,   btnGunB,        btnGunA,        btnStart,       btnSelect}},
 
-        {"adafruitItsyRP2040",      {"SAMCO 1.1",
+        {"adafruitItsyRP2040",      "SAMCO 1.1",
                                     {   btnUnmapped,   btnUnmapped,    camSDA,         camSCL,         btnUnmapped,
                                         btnUnmapped,   btnGunA,        btnGunB,        rumblePin,      btnHome,
                                         btnTrigger,    btnUnmapped,    btnUnmapped,    unavailable,    unavailable,
                                         unavailable,   unavailable,    unavailable,    btnUnmapped,    btnUnmapped,
                                         btnUnmapped,   unavailable,    unavailable,    unavailable,    btnUnmapped,
-                                        btnUnmapped,   btnUnmapped,    btnPedal,       btnUnmapped,    btnUnmapped}}},
-    };
+                                        btnUnmapped,   btnUnmapped,    btnPedal,       btnUnmapped,    btnUnmapped}},
+    });
+
+    /// @brief      Contiguous range of a board's entries in boardsAltPresets
+    typedef struct {
+        const boardAltPresetsMap_t *first;
+        const boardAltPresetsMap_t *last;
+        const boardAltPresetsMap_t *begin() const { return first; }
+        const boardAltPresetsMap_t *end() const { return last; }
+        size_t size() const { return last - first; }
+    } boardAltPresetsRange_t;
+
+    /// @brief      Index of boardsAltPresets by board, generated once on construction
+    /// @details    Value = [first, last) positions of the board's presets in boardsAltPresets.
+    std::unordered_map<std::string_view, std::pair<size_t, size_t>> boardsAltPresetsIndex;
+
+    /// @brief      Gets the alt presets for a board, in listed order
+    /// @return     Range over the board's boardsAltPresets entries (empty if it has none)
+    boardAltPresetsRange_t altPresetsFor(std::string_view board) const {
+        auto range = boardsAltPresetsIndex.find(board);
+        if(range == boardsAltPresetsIndex.end())
+            return {nullptr, nullptr};
+        return {boardsAltPresets.data() + range->second.first, boardsAltPresets.data() + range->second.second};
+    }
+
+    /// @brief      Checks boardsAltPresets for listing mistakes
+    /// @details    Reports presets for boards that aren't in boardsPresetsMap, and presets whose pin count
+    ///             doesn't match the board's boardsPresetsMap entry.
+    /// @return     One line per problem found; empty if the presets are all valid
+    std::vector<std::string> altPresetsErrors() const {
+        std::vector<std::string> errors;
+        for(auto &preset : boardsAltPresets) {
+            const std::string name = std::string(preset.board) + " \"" + preset.name + "\"";
+            auto defaults = boardsPresetsMap.find(preset.board);
+            if(defaults == boardsPresetsMap.end())
+                errors.push_back(name + ": board has no entry in boardsPresetsMap");
+            else if(defaults->second.size() != preset.pin.size())
+                errors.push_back(name + ": " + std::to_string(preset.pin.size()) + " pins, but " +
+                                 std::to_string(defaults->second.size()) + " pins in boardsPresetsMap");
+        }
+        return errors;
+    }
+
+    /// @brief      Alt preset imported by the user at runtime (e.g. from an exported layout file)
+    typedef struct {
+        std::string board;
+        std::string name;
+        std::vector<int> pin;
+    } boardUserPreset_t;
+
+    /// @brief      Runtime list of user-imported presets, kept apart from the builtin boardsAltPresets
+    /// @details    A deque, so pointers to earlier presets stay valid as more are added.
+    std::deque<boardUserPreset_t> boardsUserPresets;
+
+    /// @brief      Adds a user-imported preset for a board
+    /// @return     The stored preset, or nullptr if the board isn't in boardsPresetsMap or the pin count doesn't match its entry
+    const boardUserPreset_t *addUserPreset(std::string_view board, std::string_view name, const std::vector<int> &pins) {
+        auto defaults = boardsPresetsMap.find(board);
+        if(defaults == boardsPresetsMap.end() || defaults->second.size() != pins.size())
+            return nullptr;
+        boardsUserPresets.push_back({std::string(board), std::string(name), pins});
+        return &boardsUserPresets.back();
+    }
 
 #endif
 };
@@ -0,0 +1,91 @@
+/*!
+* @file  boardPicsCache.h
+* @brief On-demand loading of board vectors for OpenFIRE configuration apps.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _BOARDPICSCACHE_H_
+#define _BOARDPICSCACHE_H_
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <utility>
+
+#include "boardPicsIndex.h"
+
+/// @brief      Small LRU cache of parsed board vectors
+/// @details    Doc is whatever the app parses a vector into (e.g. a QSvgRenderer).
+///             Nothing is parsed up front: the catalogue in boardPicsIndex.h is enough to list boards,
+///             and a board's vector is only loaded the first time it's shown.
+///             Once Capacity documents are loaded, the least recently shown one is dropped.
+///             Capacity 2 covers the docked board plus one other (e.g. in View Compatible Boards).
+template<typename Doc, size_t Capacity = 2>
+class BoardPicCache
+{
+public:
+    /// @brief      Gets the parsed vector for a board, loading it if it isn't already cached
+    /// @param      board
+    ///             Board name as reported by OPENFIRE_BOARD (unknown boards use the generic vector)
+    /// @param      load
+    ///             Callable taking a (const boardPicIndex_t &) that returns a std::unique_ptr<Doc>,
+    ///             e.g. by loading from its .resource path
+    /// @return     The cached document, or nullptr if there's no vector or loading failed
+    template<typename Loader>
+    Doc *get(std::string_view board, Loader &&load) {
+        const boardPicIndex_t *pic = boardPicFind(board);
+        if(!pic) return nullptr;
+
+        slot_t *victim = &slots[0];
+        for(auto &slot : slots) {
+            if(slot.pic == pic && slot.doc) {
+                slot.used = ++tick;
+                return slot.doc.get();
+            } else if(!slot.doc || (victim->doc && slot.used < victim->used))
+                victim = &slot;
+        }
+
+        // only evict once there's something to replace it with, so a failed load keeps the cache intact
+        std::unique_ptr<Doc> doc = load(*pic);
+        if(!doc) return nullptr;
+        victim->doc = std::move(doc);
+        victim->pic = pic;
+        victim->used = ++tick;
+        return victim->doc.get();
+    }
+
+    /// @brief      Drops every cached document
+    void clear() {
+        for(auto &slot : slots) {
+            slot.doc.reset();
+            slot.pic = nullptr;
+        }
+    }
+
+private:
+    typedef struct {
+        const boardPicIndex_t *pic = nullptr;
+        std::unique_ptr<Doc> doc;
+        uint32_t used = 0;
+    } slot_t;
+
+    std::array<slot_t, Capacity> slots;
+    uint32_t tick = 0;
+};
+
+#endif // _BOARDPICSCACHE_H_
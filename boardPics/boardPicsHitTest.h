@@ -0,0 +1,132 @@
+/*!
+* @file  boardPicsHitTest.h
+* @brief Constant-time pin lookups for board views in OpenFIRE configuration apps.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _BOARDPICSHITTEST_H_
+#define _BOARDPICSHITTEST_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "boardPicsIndex.h"
+#include "../OpenFIREshared.h"
+
+#ifndef OF_APP
+#error "boardPicsHitTest.h requires OF_APP"
+#endif
+
+/// @brief      Spatial index of a board's pin labels and highlight shapes
+/// @details    Built once per board (e.g. when it's docked), after which:
+///              - labelPin() maps a label's side & slot from boardsBoxLayouts to its GPIO,
+///              - pinAt() maps a point on the board vector to the GPIO whose highlight is under it,
+///              - highlight() maps a GPIO to its highlight element,
+///             all without searching the SVG or the layout lists.
+class BoardPicHitIndex
+{
+public:
+    /// @param      pic
+    ///             Board's entry in boardPicsIndex (see boardPicFind())
+    /// @param      layout
+    ///             Board's entry in OF_Const::boardsBoxLayouts
+    BoardPicHitIndex(const boardPicIndex_t &pic, const OF_Const::boardBoxLayout_t &layout) : pic(pic) {
+        // label slots -> GPIO
+        const std::vector<OF_Const::boardBoxSlot_t> *sides[sidesCount] = { &layout.left, &layout.right, &layout.middle };
+        for(int side = 0; side < sidesCount; ++side) {
+            if(sides[side]->empty()) continue;
+            slots[side].assign(sides[side]->back().slot + 1, -1);
+            for(auto &box : *sides[side])
+                slots[side][box.slot] = box.pin;
+        }
+
+        // highlight shapes -> uniform grid over the viewBox, roughly square cells
+        const float w = pic.viewBox[2], h = pic.viewBox[3];
+        cols = w >= h ? cellsAcross : std::max(1, (int)(cellsAcross * w / h));
+        rows = h >= w ? cellsAcross : std::max(1, (int)(cellsAcross * h / w));
+        cellW = w / cols;
+        cellH = h / rows;
+
+        std::vector<std::vector<uint8_t>> buckets(cols * rows);
+        for(size_t gpio = 0; gpio < pic.pinsCount; ++gpio) {
+            const boardPinHighlight_t &pin = pic.pins[gpio];
+            if(!pin.id) continue;
+            const int c0 = cellX(pin.bbox[0]), c1 = cellX(pin.bbox[0] + pin.bbox[2]);
+            const int r0 = cellY(pin.bbox[1]), r1 = cellY(pin.bbox[1] + pin.bbox[3]);
+            for(int r = r0; r <= r1; ++r)
+                for(int c = c0; c <= c1; ++c)
+                    buckets[r * cols + c].push_back(gpio);
+        }
+
+        // flatten, so each cell's candidates are one contiguous run
+        cellStart.reserve(buckets.size() + 1);
+        for(auto &bucket : buckets) {
+            cellStart.push_back(cellPins.size());
+            cellPins.insert(cellPins.end(), bucket.begin(), bucket.end());
+        }
+        cellStart.push_back(cellPins.size());
+    }
+
+    /// @brief      Gets the GPIO whose highlight contains a point
+    /// @param      x, y
+    ///             Point in the board vector's viewBox coordinates
+    /// @return     GPIO number, or -1 if the point isn't over any pin
+    int pinAt(float x, float y) const {
+        if(x < pic.viewBox[0] || y < pic.viewBox[1] ||
+           x > pic.viewBox[0] + pic.viewBox[2] || y > pic.viewBox[1] + pic.viewBox[3])
+            return -1;
+        const int cell = cellY(y) * cols + cellX(x);
+        for(uint32_t i = cellStart[cell]; i < cellStart[cell+1]; ++i) {
+            const float *box = pic.pins[cellPins[i]].bbox;
+            if(x >= box[0] && x <= box[0] + box[2] && y >= box[1] && y <= box[1] + box[3])
+                return cellPins[i];
+        }
+        return -1;
+    }
+
+    /// @brief      Gets the GPIO shown at a label slot
+    /// @param      side
+    ///             OF_Const::posLeft, posRight or posMiddle
+    /// @return     GPIO number, or -1 if nothing is in that slot
+    int labelPin(int side, unsigned int slot) const {
+        const int i = side == OF_Const::posLeft ? 0 : side == OF_Const::posRight ? 1 : side == OF_Const::posMiddle ? 2 : -1;
+        return (i >= 0 && slot < slots[i].size()) ? slots[i][slot] : -1;
+    }
+
+    /// @brief      Gets the highlight element for a GPIO
+    /// @return     Highlight, or nullptr if the board vector doesn't have one for this GPIO
+    const boardPinHighlight_t *highlight(int gpio) const {
+        return (gpio >= 0 && (size_t)gpio < pic.pinsCount && pic.pins[gpio].id) ? &pic.pins[gpio] : nullptr;
+    }
+
+private:
+    static constexpr int cellsAcross = 16;
+    static constexpr int sidesCount = 3;
+
+    int cellX(float x) const { return std::min(cols - 1, std::max(0, (int)((x - pic.viewBox[0]) / cellW))); }
+    int cellY(float y) const { return std::min(rows - 1, std::max(0, (int)((y - pic.viewBox[1]) / cellH))); }
+
+    const boardPicIndex_t &pic;
+    std::vector<int> slots[sidesCount];
+    int cols, rows;
+    float cellW, cellH;
+    std::vector<uint32_t> cellStart;
+    std::vector<uint8_t> cellPins;
+};
+
+#endif // _BOARDPICSHITTEST_H_
@@ -0,0 +1,421 @@
+// Generated by tools/svgPinIndex.py from boardPics/boards.qrc -- do not edit by hand!
+// Re-run the script whenever a board vector is added or changed.
+
+#ifndef _BOARDPICSINDEX_H_
+#define _BOARDPICSINDEX_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+/// @brief      Highlight element for a single GPIO in a board vector
+/// @details    bbox (x, y, w, h) is in the document's viewBox coordinates with all transforms applied;
+///             path is the raw element geometry, which is mapped to the document by xform (SVG matrix a-f).
+///             Entries for GPIO without a highlight have a null id.
+typedef struct {
+    const char *id;
+    float bbox[4];
+    float xform[6];
+    const char *path;
+} boardPinHighlight_t;
+
+/// @brief      Catalogue entry for a board vector
+/// @details    Lightweight enough to keep resident; the vector itself is only loaded from resource
+///             (a Qt resource path) when the board is actually shown.
+typedef struct {
+    std::string_view board;
+    const char *resource;
+    uint32_t bytes;
+    float viewBox[4];
+    const boardPinHighlight_t *pins; // indexed by GPIO
+    size_t pinsCount;
+} boardPicIndex_t;
+
+static constexpr boardPinHighlight_t boardPinHighlights_rpipico[] = {
+    /*00*/ {"OF_pin0", {7.1, 20.6, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,27c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*01*/ {"OF_pin1", {7.1, 41, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,47.4c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*02*/ {"OF_pin2", {7.2, 81.7, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,88.1c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*03*/ {"OF_pin3", {7.1, 102.3, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,108.7c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*04*/ {"OF_pin4", {7.1, 122.5, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,128.9c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*05*/ {"OF_pin5", {7.1, 143, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,149.4c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*06*/ {"OF_pin6", {7.2, 183.8, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,190.2c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*07*/ {"OF_pin7", {7.2, 204.3, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,210.7c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*08*/ {"OF_pin8", {7.1, 224.7, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,231.1c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*09*/ {"OF_pin9", {7.2, 245.2, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,251.6c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*10*/ {"OF_pin10", {7.1, 285.9, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,292.3c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*11*/ {"OF_pin11", {7.1, 306.5, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,312.9c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*12*/ {"OF_pin12", {7.2, 326.9, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,333.3c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*13*/ {"OF_pin13", {7.2, 347.3, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,353.7c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*14*/ {"OF_pin14", {7.1, 388.1, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,394.5c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*15*/ {"OF_pin15", {7, 408.5, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.6,414.9c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4,0,6.3,2.6,6.5,6"},
+    /*16*/ {"OF_pin16", {150, 408.3, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,414.7c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*17*/ {"OF_pin17", {150, 388.1, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,394.5c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*18*/ {"OF_pin18", {150, 347.3, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,353.7c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*19*/ {"OF_pin19", {149.9, 326.9, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.5,333.3c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*20*/ {"OF_pin20", {150.1, 306.5, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.7,312.9c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*21*/ {"OF_pin21", {150, 286.1, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,292.5c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*22*/ {"OF_pin22", {150.1, 245.1, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.7,251.5c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*26*/ {"OF_pin26", {150, 204.2, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,210.6c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*27*/ {"OF_pin27", {150, 183.8, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,190.2c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+    /*28*/ {"OF_pin28", {150.1, 143, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.7,149.4c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4,3.4,0,6.3,2.6,6.5,6"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_rpipicow[] = {
+    /*00*/ {"OF_pin0", {7.1, 20.6, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,27c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*01*/ {"OF_pin1", {7.1, 41, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,47.4c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*02*/ {"OF_pin2", {7.2, 81.8, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,88.2c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4s6.3,2.6,6.5,6"},
+    /*03*/ {"OF_pin3", {7.1, 102.4, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,108.8c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*04*/ {"OF_pin4", {7.1, 122.6, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,129c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4s6.3,2.6,6.5,6"},
+    /*05*/ {"OF_pin5", {7.1, 143.1, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,149.5c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*06*/ {"OF_pin6", {7.2, 184, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,190.4c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*07*/ {"OF_pin7", {7.2, 204.5, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,210.9c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*08*/ {"OF_pin8", {7.1, 224.9, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,231.3c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2s2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*09*/ {"OF_pin9", {7.2, 245.4, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,251.8c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2c0-3.4,2.7-6.3,6.1-6.4s6.3,2.6,6.5,6"},
+    /*10*/ {"OF_pin10", {7.1, 286.2, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,292.6c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4s6.3,2.6,6.5,6"},
+    /*11*/ {"OF_pin11", {7.1, 306.8, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,313.2c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2s2.7-6.3,6.1-6.4c3.4-.1,6.3,2.6,6.5,6"},
+    /*12*/ {"OF_pin12", {7.2, 327.2, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,333.6c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2s2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*13*/ {"OF_pin13", {7.2, 347.6, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.8,354c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*14*/ {"OF_pin14", {7.1, 388.5, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.7,394.9c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2s2.7-6.3,6.1-6.4,6.3,2.6,6.5,6"},
+    /*15*/ {"OF_pin15", {7, 408.9, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M19.6,415.3c0,3.4-2.9,6.2-6.3,6.2s-6.2-2.8-6.3-6.2,2.7-6.3,6.1-6.4c3.4-.1,6.3,2.6,6.5,6"},
+    /*16*/ {"OF_pin16", {150, 408.7, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,415.1c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*17*/ {"OF_pin17", {150, 388.5, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,394.9c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*18*/ {"OF_pin18", {150, 347.6, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,354c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*19*/ {"OF_pin19", {149.9, 327.2, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.5,333.6c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*20*/ {"OF_pin20", {150.1, 306.8, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.7,313.2c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*21*/ {"OF_pin21", {150, 286.4, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,292.8c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*22*/ {"OF_pin22", {150.1, 245.3, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.7,251.7c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*26*/ {"OF_pin26", {150, 204.4, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,210.8c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*27*/ {"OF_pin27", {150, 184, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.6,190.4c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+    /*28*/ {"OF_pin28", {150.1, 143.1, 12.6, 12.6}, {1, 0, 0, 1, 0, 0}, "M162.7,149.5c0,3.4-2.9,6.2-6.3,6.2-3.4,0-6.2-2.8-6.3-6.2,0-3.4,2.7-6.3,6.1-6.4,3.4-.1,6.3,2.6,6.5,6"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_rpipico2[] = {
+    /*00*/ {"OF_pin0", {2.296, 6.796, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,27 c 0,3.4 -2.9,6.2 -6.3,6.2 C 10,33.2 7.2,30.4 7.1,27 7,23.6 9.8,20.7 13.2,20.6 c 3.4,0 6.3,2.6 6.5,6"},
+    /*01*/ {"OF_pin1", {2.296, 13.626, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,47.4 c 0,3.4 -2.9,6.2 -6.3,6.2 C 10,53.6 7.2,50.8 7.1,47.4 7,44 9.8,41.1 13.2,41 c 3.4,0 6.3,2.6 6.5,6"},
+    /*02*/ {"OF_pin2", {2.329, 27.254, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.8,88.1 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*03*/ {"OF_pin3", {2.296, 34.151, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,108.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*04*/ {"OF_pin4", {2.296, 40.915, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,128.9 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*05*/ {"OF_pin5", {2.296, 47.779, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,149.4 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*06*/ {"OF_pin6", {2.329, 61.44, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.8,190.2 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*07*/ {"OF_pin7", {2.329, 68.304, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.8,210.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*08*/ {"OF_pin8", {2.296, 75.134, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,231.1 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*09*/ {"OF_pin9", {2.329, 81.998, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.8,251.6 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*10*/ {"OF_pin10", {2.296, 95.626, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,292.3 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*11*/ {"OF_pin11", {2.296, 102.523, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,312.9 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*12*/ {"OF_pin12", {2.329, 109.354, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.8,333.3 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*13*/ {"OF_pin13", {2.329, 116.184, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.8,353.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*14*/ {"OF_pin14", {2.296, 129.845, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.7,394.5 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*15*/ {"OF_pin15", {2.262, 136.676, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 19.6,414.9 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*16*/ {"OF_pin16", {50.143, 136.609, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.6,414.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*17*/ {"OF_pin17", {50.143, 129.845, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.6,394.5 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*18*/ {"OF_pin18", {50.143, 116.184, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.6,353.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*19*/ {"OF_pin19", {50.109, 109.354, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.5,333.3 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*20*/ {"OF_pin20", {50.176, 102.523, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.7,312.9 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*21*/ {"OF_pin21", {50.143, 95.693, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.6,292.5 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*22*/ {"OF_pin22", {50.176, 81.965, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.7,251.5 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*26*/ {"OF_pin26", {50.143, 68.27, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.6,210.6 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*27*/ {"OF_pin27", {50.143, 61.44, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.6,190.2 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*28*/ {"OF_pin28", {50.176, 47.779, 4.219, 4.219}, {0.334829, 0, 0, 0.334829, -0.081512, -0.10167}, "m 162.7,149.4 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_rpipico2w[] = {
+    /*00*/ {"OF_pin0", {6.098, 19.343, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,27 c 0,3.4 -2.9,6.2 -6.3,6.2 C 10,33.2 7.2,30.4 7.1,27 7,23.6 9.8,20.7 13.2,20.6 c 3.4,0 6.3,2.6 6.5,6"},
+    /*01*/ {"OF_pin1", {6.098, 37.689, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,47.4 c 0,3.4 -2.9,6.2 -6.3,6.2 C 10,53.6 7.2,50.8 7.1,47.4 7,44 9.8,41.1 13.2,41 c 3.4,0 6.3,2.6 6.5,6"},
+    /*02*/ {"OF_pin2", {6.188, 74.292, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.8,88.1 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*03*/ {"OF_pin3", {6.098, 92.818, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,108.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*04*/ {"OF_pin4", {6.098, 110.984, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,128.9 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*05*/ {"OF_pin5", {6.098, 129.421, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,149.4 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*06*/ {"OF_pin6", {6.188, 166.113, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.8,190.2 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*07*/ {"OF_pin7", {6.188, 184.55, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.8,210.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*08*/ {"OF_pin8", {6.098, 202.896, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,231.1 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*09*/ {"OF_pin9", {6.188, 221.332, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.8,251.6 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*10*/ {"OF_pin10", {6.098, 257.935, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,292.3 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*11*/ {"OF_pin11", {6.098, 276.461, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,312.9 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*12*/ {"OF_pin12", {6.188, 294.807, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.8,333.3 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*13*/ {"OF_pin13", {6.188, 313.154, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.8,353.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*14*/ {"OF_pin14", {6.098, 349.846, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.7,394.5 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*15*/ {"OF_pin15", {6.008, 368.193, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 19.6,414.9 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 -.1,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*16*/ {"OF_pin16", {134.612, 368.013, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.6,414.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*17*/ {"OF_pin17", {134.612, 349.846, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.6,394.5 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*18*/ {"OF_pin18", {134.612, 313.154, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.6,353.7 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*19*/ {"OF_pin19", {134.522, 294.807, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.5,333.3 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*20*/ {"OF_pin20", {134.702, 276.461, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.7,312.9 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*21*/ {"OF_pin21", {134.612, 258.115, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.6,292.5 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*22*/ {"OF_pin22", {134.702, 221.242, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.7,251.5 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*26*/ {"OF_pin26", {134.612, 184.46, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.6,210.6 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*27*/ {"OF_pin27", {134.612, 166.113, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.6,190.2 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+    /*28*/ {"OF_pin28", {134.702, 129.421, 11.332, 11.332}, {0.899329, 0, 0, 0.899329, -0.287132, 0.816682}, "m 162.7,149.4 c 0,3.4 -2.9,6.2 -6.3,6.2 -3.4,0 -6.2,-2.8 -6.3,-6.2 0,-3.4 2.7,-6.3 6.1,-6.4 3.4,0 6.3,2.6 6.5,6"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_adafruitItsyRP2040[] = {
+    /*00*/ {"OF_pin0", {44.604, 87.768, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.36,90.042 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*01*/ {"OF_pin1", {44.583, 94.993, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.381,97.267 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*02*/ {"OF_pin2", {44.604, 80.587, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.36,82.861 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*03*/ {"OF_pin3", {44.562, 73.384, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.402,75.658 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*04*/ {"OF_pin4", {37.401, 94.993, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -8.563,97.267 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*05*/ {"OF_pin5", {30.219, 94.971, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -15.745,97.245 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*06*/ {"OF_pin6", {44.583, 58.999, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.381,61.273 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*07*/ {"OF_pin7", {44.604, 51.796, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.36,54.07 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*08*/ {"OF_pin8", {44.626, 44.529, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.338,46.803 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*09*/ {"OF_pin9", {44.583, 37.39, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.381,39.664 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*10*/ {"OF_pin10", {44.613, 30.178, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.351,32.452 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*11*/ {"OF_pin11", {44.583, 22.996, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.381,25.27 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*12*/ {"OF_pin12", {1.386, 94.971, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.578,97.245 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*13*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*14*/ {"OF_pin14", {44.626, 66.18, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -1.338,68.454 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*15*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*16*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*17*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*18*/ {"OF_pin18", {1.429, 73.384, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.535,75.658 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*19*/ {"OF_pin19", {1.429, 80.587, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.535,82.861 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*20*/ {"OF_pin20", {1.429, 87.79, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.535,90.064 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*21*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*22*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {"OF_pin24", {1.407, 58.935, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.557,61.209 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*25*/ {"OF_pin25", {1.407, 66.18, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.557,68.454 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*26*/ {"OF_pin26", {1.386, 30.187, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.578,32.461 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*27*/ {"OF_pin27", {1.386, 37.39, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.578,39.664 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*28*/ {"OF_pin28", {1.45, 44.571, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.514,46.845 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+    /*29*/ {"OF_pin29", {1.386, 51.817, 4.436, 4.446}, {1, 0, 0, 1, 50.4, 0}, "m -44.578,54.091 a 2.218,2.224 0 0 1 -2.23,2.172 2.218,2.224 0 0 1 -2.206,-2.197 2.218,2.224 0 0 1 2.153,-2.249 2.218,2.224 0 0 1 2.281,2.118"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_adafruitKB2040[] = {
+    /*00*/ {"OF_pin0", {1.4, 12.2, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,14.4c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*01*/ {"OF_pin1", {1.4, 19.4, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,21.6c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*02*/ {"OF_pin2", {1.4, 41, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,43.2c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*03*/ {"OF_pin3", {1.4, 48.2, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,50.4c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*04*/ {"OF_pin4", {1.4, 55.4, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,57.6c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*05*/ {"OF_pin5", {1.4, 62.6, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,64.8c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*06*/ {"OF_pin6", {1.4, 69.8, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,72c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*07*/ {"OF_pin7", {1.4, 77, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,79.2c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*08*/ {"OF_pin8", {1.4, 84.2, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,86.4c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*09*/ {"OF_pin9", {1.4, 91.4, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M5.8,93.6c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*10*/ {"OF_pin10", {44.6, 91.4, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49,93.6c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*11*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*12*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*13*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*14*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*15*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*16*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*17*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*18*/ {"OF_pin18", {44.6, 69.8, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49,72c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*19*/ {"OF_pin19", {44.6, 84.2, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49,86.4c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*20*/ {"OF_pin20", {44.5, 77, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M48.9,79.2c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*21*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*22*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*26*/ {"OF_pin26", {44.6, 62.6, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49,64.8c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*27*/ {"OF_pin27", {44.6, 55.4, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49,57.6c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*28*/ {"OF_pin28", {44.6, 48.1, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49,50.3c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*29*/ {"OF_pin29", {44.6, 41, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49,43.2c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_arduinoNanoRP2040[] = {
+    /*00*/ {"OF_pin0", {44.7, 119.1, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,121.1c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*01*/ {"OF_pin1", {44.7, 111.9, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,113.9c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*02*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*03*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*04*/ {"OF_pin4", {44.7, 18.4, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,20.4c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*05*/ {"OF_pin5", {44.7, 32.8, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,34.8c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*06*/ {"OF_pin06", {1.5, 18.4, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M5.3,20.4c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*07*/ {"OF_pin7", {44.7, 25.6, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,27.6c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*08*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*09*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*10*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*11*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*12*/ {"OF_pin12", {1.5, 68.8, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M5.3,70.8c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*13*/ {"OF_pin13", {1.5, 76, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M5.3,78c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*14*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*15*/ {"OF_pin15", {44.7, 83.2, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,85.2c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*16*/ {"OF_pin16", {44.7, 76, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,78c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*17*/ {"OF_pin17", {44.7, 68.8, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,70.8c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*18*/ {"OF_pin18", {44.7, 61.6, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,63.6c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*19*/ {"OF_pin19", {44.7, 54.4, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,56.4c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*20*/ {"OF_pin20", {44.7, 47.2, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,49.2c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*21*/ {"OF_pin21", {44.7, 40, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,42c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*22*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {"OF_pin25", {44.7, 90.4, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M48.5,92.4c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*26*/ {"OF_pin26", {1.5, 40, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M5.3,42c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*27*/ {"OF_pin27", {1.5, 47.2, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M5.3,49.2c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*28*/ {"OF_pin28", {1.5, 54.4, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M5.3,56.4c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+    /*29*/ {"OF_pin29", {1.5, 61.6, 3.9, 3.9}, {1, 0, 0, 1, 0, 0}, "M5.3,63.6c0,1.1-.9,1.9-1.9,1.9s-1.9-.9-1.9-1.9.8-1.9,1.9-2,1.9.8,2,1.9"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_waveshareZero[] = {
+    /*00*/ {"OF_pin0", {44.9, 6.3, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.3,8.5c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*01*/ {"OF_pin1", {44.9, 13.5, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.3,15.7c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*02*/ {"OF_pin2", {44.9, 20.7, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.3,22.9c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*03*/ {"OF_pin3", {45, 27.9, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.4,30.1c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*04*/ {"OF_pin4", {45, 35, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.4,37.2c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*05*/ {"OF_pin5", {44.9, 42.2, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.3,44.4c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*06*/ {"OF_pin6", {45, 49.4, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.4,51.6c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*07*/ {"OF_pin7", {44.9, 56.6, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.3,58.8c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*08*/ {"OF_pin8", {45, 63.8, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M49.4,66c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*09*/ {"OF_pin9", {37.8, 63.9, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M42.2,66.1c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*10*/ {"OF_pin10", {30.6, 63.9, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M35,66.1c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*11*/ {"OF_pin11", {23.3, 63.9, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M27.7,66.1c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*12*/ {"OF_pin12", {16.2, 63.9, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M20.6,66.1c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*13*/ {"OF_pin13", {9, 63.9, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M13.4,66.1c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*14*/ {"OF_pin14", {1.8, 63.8, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M6.2,66c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*15*/ {"OF_pin15", {1.8, 56.6, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M6.2,58.8c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*16*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*17*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*18*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*19*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*20*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*21*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*22*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*26*/ {"OF_pin26", {1.8, 49.4, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M6.2,51.6c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*27*/ {"OF_pin27", {1.8, 42.2, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M6.2,44.4c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*28*/ {"OF_pin28", {1.7, 35, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M6.1,37.2c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+    /*29*/ {"OF_pin29", {1.8, 27.8, 4.5, 4.4}, {1, 0, 0, 1, 0, 0}, "M6.2,30c0,1.2-1,2.2-2.2,2.2s-2.2-1-2.2-2.2.9-2.2,2.2-2.2,2.2.9,2.3,2.1"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_esp32_s3_devkitc_1[] = {
+    /*00*/ {"OF_pin0", {6.113, 123.49, 8, 8}, {1, 0, 0, 1, 0, 0}, "M6.113,127.49A4,4 0 1 0 14.113,127.49A4,4 0 1 0 6.113,127.49Z"},
+    /*01*/ {"OF_pin1", {5.614, 259.403, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.614,263.403A4,4 0 1 0 13.614,263.403A4,4 0 1 0 5.614,263.403Z"},
+    /*02*/ {"OF_pin2", {5.634, 245.601, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.634,249.601A4,4 0 1 0 13.634,249.601A4,4 0 1 0 5.634,249.601Z"},
+    /*03*/ {"OF_pin3", {146.475, 137.201, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.475,141.201A4,4 0 1 0 154.475,141.201A4,4 0 1 0 146.475,141.201Z"},
+    /*04*/ {"OF_pin4", {146.028, 259.817, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.028,263.817A4,4 0 1 0 154.028,263.817A4,4 0 1 0 146.028,263.817Z"},
+    /*05*/ {"OF_pin5", {146.03, 246.233, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.03,250.233A4,4 0 1 0 154.03,250.233A4,4 0 1 0 146.03,250.233Z"},
+    /*06*/ {"OF_pin6", {146.221, 232.577, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.221,236.577A4,4 0 1 0 154.221,236.577A4,4 0 1 0 146.221,236.577Z"},
+    /*07*/ {"OF_pin7", {145.996, 218.974, 8, 8}, {1, 0, 0, 1, 0, 0}, "M145.996,222.974A4,4 0 1 0 153.996,222.974A4,4 0 1 0 145.996,222.974Z"},
+    /*08*/ {"OF_pin8", {146.322, 150.889, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.322,154.889A4,4 0 1 0 154.322,154.889A4,4 0 1 0 146.322,154.889Z"},
+    /*09*/ {"OF_pin9", {146.895, 110.025, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.895,114.025A4,4 0 1 0 154.895,114.025A4,4 0 1 0 146.895,114.025Z"},
+    /*10*/ {"OF_pin10", {146.601, 96.442, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.601,100.442A4,4 0 1 0 154.601,100.442A4,4 0 1 0 146.601,100.442Z"},
+    /*11*/ {"OF_pin11", {146.965, 82.842, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.965,86.842A4,4 0 1 0 154.965,86.842A4,4 0 1 0 146.965,86.842Z"},
+    /*12*/ {"OF_pin12", {146.792, 68.947, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.792,72.947A4,4 0 1 0 154.792,72.947A4,4 0 1 0 146.792,72.947Z"},
+    /*13*/ {"OF_pin13", {147.202, 55.513, 8, 8}, {1, 0, 0, 1, 0, 0}, "M147.202,59.513A4,4 0 1 0 155.202,59.513A4,4 0 1 0 147.202,59.513Z"},
+    /*14*/ {"OF_pin14", {147.18, 41.597, 8, 8}, {1, 0, 0, 1, 0, 0}, "M147.18,45.597A4,4 0 1 0 155.18,45.597A4,4 0 1 0 147.18,45.597Z"},
+    /*15*/ {"OF_pin15", {146.247, 205.675, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.247,209.675A4,4 0 1 0 154.247,209.675A4,4 0 1 0 146.247,209.675Z"},
+    /*16*/ {"OF_pin16", {146.442, 191.859, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.442,195.859A4,4 0 1 0 154.442,195.859A4,4 0 1 0 146.442,195.859Z"},
+    /*17*/ {"OF_pin17", {146.342, 178.25, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.342,182.25A4,4 0 1 0 154.342,182.25A4,4 0 1 0 146.342,182.25Z"},
+    /*18*/ {"OF_pin18", {146.442, 164.581, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.442,168.581A4,4 0 1 0 154.442,168.581A4,4 0 1 0 146.442,168.581Z"},
+    /*19*/ {"OF_pin19", {6.345, 41.729, 8, 8}, {1, 0, 0, 1, 0, 0}, "M6.345,45.729A4,4 0 1 0 14.345,45.729A4,4 0 1 0 6.345,45.729Z"},
+    /*20*/ {"OF_pin20", {6.22, 55.437, 8, 8}, {1, 0, 0, 1, 0, 0}, "M6.22,59.437A4,4 0 1 0 14.22,59.437A4,4 0 1 0 6.22,59.437Z"},
+    /*21*/ {"OF_pin21", {6.356, 68.863, 8, 8}, {1, 0, 0, 1, 0, 0}, "M6.356,72.863A4,4 0 1 0 14.356,72.863A4,4 0 1 0 6.356,72.863Z"},
+    /*22*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*26*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*27*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*28*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*29*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*30*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*31*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*32*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*33*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*34*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*35*/ {"OF_pin35", {6.089, 136.769, 8, 8}, {1, 0, 0, 1, 0, 0}, "M6.089,140.769A4,4 0 1 0 14.089,140.769A4,4 0 1 0 6.089,140.769Z"},
+    /*36*/ {"OF_pin36", {5.924, 150.571, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.924,154.571A4,4 0 1 0 13.924,154.571A4,4 0 1 0 5.924,154.571Z"},
+    /*37*/ {"OF_pin37", {5.755, 164.18, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.755,168.18A4,4 0 1 0 13.755,168.18A4,4 0 1 0 5.755,168.18Z"},
+    /*38*/ {"OF_pin38", {5.789, 177.469, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.789,181.469A4,4 0 1 0 13.789,181.469A4,4 0 1 0 5.789,181.469Z"},
+    /*39*/ {"OF_pin39", {5.705, 191.25, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.705,195.25A4,4 0 1 0 13.705,195.25A4,4 0 1 0 5.705,195.25Z"},
+    /*40*/ {"OF_pin40", {5.677, 205.088, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.677,209.088A4,4 0 1 0 13.677,209.088A4,4 0 1 0 5.677,209.088Z"},
+    /*41*/ {"OF_pin41", {5.596, 218.506, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.596,222.506A4,4 0 1 0 13.596,222.506A4,4 0 1 0 5.596,222.506Z"},
+    /*42*/ {"OF_pin42", {5.729, 232.112, 8, 8}, {1, 0, 0, 1, 0, 0}, "M5.729,236.112A4,4 0 1 0 13.729,236.112A4,4 0 1 0 5.729,236.112Z"},
+    /*43*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*44*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*45*/ {"OF_pin45", {6.153, 109.726, 8, 8}, {1, 0, 0, 1, 0, 0}, "M6.153,113.726A4,4 0 1 0 14.153,113.726A4,4 0 1 0 6.153,113.726Z"},
+    /*46*/ {"OF_pin46", {146.611, 123.588, 8, 8}, {1, 0, 0, 1, 0, 0}, "M146.611,127.588A4,4 0 1 0 154.611,127.588A4,4 0 1 0 146.611,127.588Z"},
+    /*47*/ {"OF_pin47", {6.22, 82.42, 8, 8}, {1, 0, 0, 1, 0, 0}, "M6.22,86.42A4,4 0 1 0 14.22,86.42A4,4 0 1 0 6.22,86.42Z"},
+    /*48*/ {"OF_pin48", {6.167, 95.858, 8, 8}, {1, 0, 0, 1, 0, 0}, "M6.167,99.858A4,4 0 1 0 14.167,99.858A4,4 0 1 0 6.167,99.858Z"},
+};
+
+static constexpr boardPinHighlight_t boardPinHighlights_waveshare_esp32_s3_pico[] = {
+    /*00*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*01*/ {"OF_pin1", {768.259, 1730.531, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,1755.762A20.853,20.468 0 1 0 816.04,1755.762A20.853,20.468 0 1 0 774.334,1755.762Z"},
+    /*02*/ {"OF_pin2", {768.259, 1628.08, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,1653.311A20.853,20.468 0 1 0 816.04,1653.311A20.853,20.468 0 1 0 774.334,1653.311Z"},
+    /*03*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*04*/ {"OF_pin4", {768.259, 1525.629, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,1550.86A20.853,20.468 0 1 0 816.04,1550.86A20.853,20.468 0 1 0 774.334,1550.86Z"},
+    /*05*/ {"OF_pin5", {768.259, 1423.178, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,1448.409A20.853,20.468 0 1 0 816.04,1448.409A20.853,20.468 0 1 0 774.334,1448.409Z"},
+    /*06*/ {"OF_pin6", {768.259, 1218.276, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,1243.507A20.853,20.468 0 1 0 816.04,1243.507A20.853,20.468 0 1 0 774.334,1243.507Z"},
+    /*07*/ {"OF_pin7", {768.259, 1013.375, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,1038.605A20.853,20.468 0 1 0 816.04,1038.605A20.853,20.468 0 1 0 774.334,1038.605Z"},
+    /*08*/ {"OF_pin8", {768.259, 910.924, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,936.155A20.853,20.468 0 1 0 816.04,936.155A20.853,20.468 0 1 0 774.334,936.155Z"},
+    /*09*/ {"OF_pin9", {768.259, 706.023, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,731.253A20.853,20.468 0 1 0 816.04,731.253A20.853,20.468 0 1 0 774.334,731.253Z"},
+    /*10*/ {"OF_pin10", {768.259, 603.572, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,628.802A20.853,20.468 0 1 0 816.04,628.802A20.853,20.468 0 1 0 774.334,628.802Z"},
+    /*11*/ {"OF_pin11", {34.614, 91.316, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,116.547A20.853,20.468 0 1 0 82.395,116.547A20.853,20.468 0 1 0 40.689,116.547Z"},
+    /*12*/ {"OF_pin12", {34.614, 193.767, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,218.998A20.853,20.468 0 1 0 82.395,218.998A20.853,20.468 0 1 0 40.689,218.998Z"},
+    /*13*/ {"OF_pin13", {34.614, 398.669, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,423.9A20.853,20.468 0 1 0 82.395,423.9A20.853,20.468 0 1 0 40.689,423.9Z"},
+    /*14*/ {"OF_pin14", {34.614, 501.12, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,526.351A20.853,20.468 0 1 0 82.395,526.351A20.853,20.468 0 1 0 40.689,526.351Z"},
+    /*15*/ {"OF_pin15", {34.614, 603.571, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,628.802A20.853,20.468 0 1 0 82.395,628.802A20.853,20.468 0 1 0 40.689,628.802Z"},
+    /*16*/ {"OF_pin16", {34.614, 706.022, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,731.253A20.853,20.468 0 1 0 82.395,731.253A20.853,20.468 0 1 0 40.689,731.253Z"},
+    /*17*/ {"OF_pin17", {34.614, 910.924, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,936.155A20.853,20.468 0 1 0 82.395,936.155A20.853,20.468 0 1 0 40.689,936.155Z"},
+    /*18*/ {"OF_pin18", {34.614, 1013.374, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,1038.605A20.853,20.468 0 1 0 82.395,1038.605A20.853,20.468 0 1 0 40.689,1038.605Z"},
+    /*19*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*20*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*21*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*22*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*23*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*24*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*25*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*26*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*27*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*28*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*29*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*30*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*31*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*32*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},
+    /*33*/ {"OF_pin33", {34.614, 1115.825, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,1141.056A20.853,20.468 0 1 0 82.395,1141.056A20.853,20.468 0 1 0 40.689,1141.056Z"},
+    /*34*/ {"OF_pin34", {34.614, 1218.276, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,1243.507A20.853,20.468 0 1 0 82.395,1243.507A20.853,20.468 0 1 0 40.689,1243.507Z"},
+    /*35*/ {"OF_pin35", {34.614, 1423.178, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,1448.409A20.853,20.468 0 1 0 82.395,1448.409A20.853,20.468 0 1 0 40.689,1448.409Z"},
+    /*36*/ {"OF_pin36", {34.614, 1525.629, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,1550.86A20.853,20.468 0 1 0 82.395,1550.86A20.853,20.468 0 1 0 40.689,1550.86Z"},
+    /*37*/ {"OF_pin37", {34.614, 1628.08, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,1653.311A20.853,20.468 0 1 0 82.395,1653.311A20.853,20.468 0 1 0 40.689,1653.311Z"},
+    /*38*/ {"OF_pin38", {34.614, 1730.531, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,1755.762A20.853,20.468 0 1 0 82.395,1755.762A20.853,20.468 0 1 0 40.689,1755.762Z"},
+    /*39*/ {"OF_pin39", {34.614, 1935.433, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,1960.664A20.853,20.468 0 1 0 82.395,1960.664A20.853,20.468 0 1 0 40.689,1960.664Z"},
+    /*40*/ {"OF_pin40", {34.614, 2037.884, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M40.689,2063.115A20.853,20.468 0 1 0 82.395,2063.115A20.853,20.468 0 1 0 40.689,2063.115Z"},
+    /*41*/ {"OF_pin41", {768.259, 1935.433, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,1960.664A20.853,20.468 0 1 0 816.04,1960.664A20.853,20.468 0 1 0 774.334,1960.664Z"},
+    /*42*/ {"OF_pin42", {768.259, 2037.884, 41.706, 40.936}, {1, 0, 0, 1, -6.07533, -4.7625}, "M774.334,2063.115A20.853,20.468 0 1 0 816.04,2063.115A20.853,20.468 0 1 0 774.334,2063.115Z"},
+};
+
+/// @brief      Pin highlight index for every board vector in boards.qrc, in resource order
+static constexpr boardPicIndex_t boardPicsIndex[] = {
+    {"rpipico", ":/boardPics/rpipico", 43617, {0, 0, 168.7, 425.9}, boardPinHighlights_rpipico, 29},
+    {"rpipicow", ":/boardPics/rpipicow", 45102, {0, 0, 168.7, 425.9}, boardPinHighlights_rpipicow, 29},
+    {"rpipico2", ":/boardPics/rpipico2", 93302, {0, 0, 56.491, 142.442}, boardPinHighlights_rpipico2, 29},
+    {"rpipico2w", ":/boardPics/rpipico2w", 89118, {0, 0, 152.313, 384.405}, boardPinHighlights_rpipico2w, 29},
+    {"adafruitItsyRP2040", ":/boardPics/adafruitItsyRP2040", 154820, {0, 0, 50.4, 100.8}, boardPinHighlights_adafruitItsyRP2040, 30},
+    {"adafruitKB2040", ":/boardPics/adafruitKB2040", 39429, {0, 0, 50.4, 97.2}, boardPinHighlights_adafruitKB2040, 30},
+    {"arduinoNanoRP2040", ":/boardPics/arduinoNanoRP2040", 72875, {0, 0, 50, 132.5}, boardPinHighlights_arduinoNanoRP2040, 30},
+    {"waveshareZero", ":/boardPics/waveshareZero", 26895, {0, 0, 51, 70.6}, boardPinHighlights_waveshareZero, 30},
+    {"esp32-s3-devkitc-1", ":/boardPics/esp32-s3-devkitc-1", 275711, {0, 0, 160, 350}, boardPinHighlights_esp32_s3_devkitc_1, 49},
+    {"waveshare-esp32-s3-pico", ":/boardPics/waveshare-esp32-s3-pico", 283033, {0, 0, 844.57, 2112.167}, boardPinHighlights_waveshare_esp32_s3_pico, 43},
+    {"generic", ":/boardPics/generic", 26264, {0, 0, 59.532, 150.242}, nullptr, 0},
+};
+
+/// @brief      Finds the catalogue entry for a board name as reported by OPENFIRE_BOARD
+/// @return     The matching entry, or the "generic" board's entry if there's no vector for it
+inline const boardPicIndex_t *boardPicFind(std::string_view board)
+{
+    const boardPicIndex_t *fallback = nullptr;
+    for(const auto &pic : boardPicsIndex) {
+        if(pic.board == board)
+            return &pic;
+        else if(pic.board == "generic")
+            fallback = &pic;
+    }
+    return fallback;
+}
+
+#endif // _BOARDPICSINDEX_H_
@@ -0,0 +1,48 @@
+/*!
+* @file  allocCounter.h
+* @brief Global operator new/delete replacements that count heap use, for the host tools.
+*        Include in exactly one translation unit.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef _ALLOCCOUNTER_H_
+#define _ALLOCCOUNTER_H_
+
+#include <cstdlib>
+#include <new>
+
+// GCC can't tell these replace the global operators, and warns about free() on new'd memory
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+static size_t allocCount = 0;
+static size_t allocBytes = 0;
+
+void *operator new(size_t size)
+{
+    ++allocCount;
+    allocBytes += size;
+    if(void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, size_t) noexcept { std::free(p); }
+
+#endif // _ALLOCCOUNTER_H_
@@ -0,0 +1,198 @@
+/*!
+* @file  irReplay.cpp
+* @brief Offline replay of IR traces captured with sIRCapture
+*
+* Build & run, e.g.:
+*   g++ -std=c++17 -O2 -I.. irReplay.cpp -o irReplay
+*   ./irReplay capture.ofir --out positions.csv
+*   ./irReplay capture.ofir --expect positions.csv --tolerance 2 --repeat 100
+*
+* Reads a saved trace (irTraceMagic, the sIRTraceHeader payload, then sIRFrameUpd payloads back to back),
+* feeds every frame through a position pipeline as fast as it will go, and reports frames per second.
+* With --out, the positions are written as CSV (time,x,y,valid); with --expect, they're compared against
+* a previous --out and the run fails if any frame differs by more than --tolerance.
+*
+* The pipeline is a stand-in that just averages the seen points. To replay through the firmware's
+* position math, build with -DOF_REPLAY_PIPELINE='"path/to/pipeline.h"', where that header defines
+* a ReplayPipeline with the same constructor and update() as the one below.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "OpenFIREshared.h"
+
+#ifdef OF_REPLAY_PIPELINE
+#include OF_REPLAY_PIPELINE
+#else
+// averages the seen points; no profile math
+class ReplayPipeline
+{
+public:
+    ReplayPipeline(const OF_Const::irTraceHeader_t &header) { (void)header; }
+
+    /// @return     false if there's no position for this frame
+    bool update(const OF_Const::irFrame_t &frame, int &x, int &y) {
+        int seen = 0;
+        x = y = 0;
+        for(int i = 0; i < 4; ++i)
+            if(frame.seen & (1 << i)) {
+                x += frame.x[i];
+                y += frame.y[i];
+                ++seen;
+            }
+        if(!seen) return false;
+        x /= seen;
+        y /= seen;
+        return true;
+    }
+};
+#endif // OF_REPLAY_PIPELINE
+
+typedef struct {
+    uint32_t time;
+    int x;
+    int y;
+    bool valid;
+} position_t;
+
+static bool readTrace(const char *path, OF_Const::irTraceHeader_t &header, std::vector<OF_Const::irFrame_t> &frames)
+{
+    std::ifstream file(path, std::ios::binary);
+    const std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    const size_t magic = sizeof(OF_Const::irTraceMagic);
+    if(data.size() < magic || std::memcmp(data.data(), OF_Const::irTraceMagic, magic)) {
+        std::fprintf(stderr, "%s: not an IR trace\n", path);
+        return false;
+    }
+    if(!OF_Const::irTraceHeaderDecode(data.data() + magic, data.size() - magic, header)) {
+        std::fprintf(stderr, "%s: unsupported or truncated trace header\n", path);
+        return false;
+    }
+    const size_t start = magic + 2 + 4 * data[magic + 1];
+    for(size_t at = start; at + OF_Const::irFrameSize <= data.size(); at += OF_Const::irFrameSize)
+        frames.push_back(OF_Const::irFrameDecode(data.data() + at));
+    if((data.size() - start) % OF_Const::irFrameSize)
+        std::fprintf(stderr, "%s: ignoring %zu trailing bytes\n", path, (data.size() - start) % OF_Const::irFrameSize);
+    return true;
+}
+
+static bool readPositions(const char *path, std::vector<position_t> &positions)
+{
+    FILE *f = std::fopen(path, "r");
+    if(!f) return false;
+    char line[128];
+    while(std::fgets(line, sizeof(line), f)) {
+        position_t p;
+        unsigned int time;
+        int valid;
+        if(std::sscanf(line, "%u,%d,%d,%d", &time, &p.x, &p.y, &valid) == 4) {
+            p.time = time;
+            p.valid = valid;
+            positions.push_back(p);
+        }
+    }
+    std::fclose(f);
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    const char *trace = nullptr, *out = nullptr, *expect = nullptr;
+    int tolerance = 0;
+    unsigned long repeat = 1;
+    for(int i = 1; i < argc; ++i) {
+        if(!std::strcmp(argv[i], "--out") && i + 1 < argc) out = argv[++i];
+        else if(!std::strcmp(argv[i], "--expect") && i + 1 < argc) expect = argv[++i];
+        else if(!std::strcmp(argv[i], "--tolerance") && i + 1 < argc) tolerance = std::atoi(argv[++i]);
+        else if(!std::strcmp(argv[i], "--repeat") && i + 1 < argc) repeat = std::strtoul(argv[++i], nullptr, 10);
+        else if(argv[i][0] != '-' && !trace) trace = argv[i];
+        else {
+            std::fprintf(stderr, "Usage: %s trace.ofir [--out file.csv] [--expect file.csv] [--tolerance N] [--repeat N]\n", argv[0]);
+            return 2;
+        }
+    }
+    if(!trace || !repeat) {
+        std::fprintf(stderr, "Usage: %s trace.ofir [--out file.csv] [--expect file.csv] [--tolerance N] [--repeat N]\n", argv[0]);
+        return 2;
+    }
+
+    OF_Const::irTraceHeader_t header;
+    std::vector<OF_Const::irFrame_t> frames;
+    if(!readTrace(trace, header, frames))
+        return 2;
+
+    // every repeat starts from a fresh pipeline, so each pass gives the same positions
+    std::vector<position_t> positions(frames.size());
+    const auto start = std::chrono::steady_clock::now();
+    for(unsigned long pass = 0; pass < repeat; ++pass) {
+        ReplayPipeline pipeline(header);
+        for(size_t i = 0; i < frames.size(); ++i) {
+            position_t &p = positions[i];
+            p.time = frames[i].time;
+            p.valid = pipeline.update(frames[i], p.x, p.y);
+        }
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("%zu frames x %lu passes in %.3f s (%.0f frames/s)\n",
+                frames.size(), repeat, seconds, seconds > 0 ? frames.size() * repeat / seconds : 0.0);
+
+    if(out) {
+        FILE *f = std::fopen(out, "w");
+        if(!f) {
+            std::fprintf(stderr, "%s: can't write\n", out);
+            return 2;
+        }
+        for(auto &p : positions)
+            std::fprintf(f, "%u,%d,%d,%d\n", p.time, p.x, p.y, p.valid);
+        std::fclose(f);
+    }
+
+    if(expect) {
+        std::vector<position_t> expected;
+        if(!readPositions(expect, expected)) {
+            std::fprintf(stderr, "%s: can't read\n", expect);
+            return 2;
+        }
+        size_t mismatches = 0;
+        if(expected.size() != positions.size()) {
+            std::printf("FAIL: %zu positions, expected %zu\n", positions.size(), expected.size());
+            return 1;
+        }
+        for(size_t i = 0; i < positions.size(); ++i) {
+            const position_t &p = positions[i], &e = expected[i];
+            if(p.valid != e.valid || (p.valid && (std::abs(p.x - e.x) > tolerance || std::abs(p.y - e.y) > tolerance))) {
+                if(mismatches++ < 10)
+                    std::printf("  frame %zu @%u: got %d,%d (%d), expected %d,%d (%d)\n",
+                                i, p.time, p.x, p.y, p.valid, e.x, e.y, e.valid);
+            }
+        }
+        if(mismatches) {
+            std::printf("FAIL: %zu of %zu frames off by more than %d\n", mismatches, positions.size(), tolerance);
+            return 1;
+        }
+        std::printf("OK: all frames within %d of %s\n", tolerance, expect);
+    }
+    return 0;
+}
@@ -0,0 +1,171 @@
+/*!
+* @file  ofBench.cpp
+* @brief Host microbenchmarks for the tables and lookups in OpenFIREshared.h
+*
+* Build & run once per configuration, e.g.:
+*   g++ -std=c++17 -O2 -I.. ofBench.cpp -o ofBench && ./ofBench
+*   g++ -std=c++17 -O2 -I.. -DOF_APP ofBench.cpp -o ofBench-app && ./ofBench-app
+*
+* Results are printed as one JSON object; each benchmark reports its time and heap allocations per operation.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "OpenFIREshared.h"
+#include "allocCounter.h"
+
+//// Harness
+
+// keeps results alive so the optimiser can't drop the work being measured
+static volatile uintptr_t sink;
+template<typename T> static void keep(const T &value) { sink = sink + (uintptr_t)value; }
+
+static std::vector<std::string> results;
+
+template<typename Fn>
+static void bench(const std::string &name, size_t iterations, Fn &&fn)
+{
+    fn(); // warm up
+
+    const size_t allocsBefore = allocCount, bytesBefore = allocBytes;
+    const auto start = std::chrono::steady_clock::now();
+    for(size_t i = 0; i < iterations; ++i)
+        fn();
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "    {\"name\": \"%s\", \"iterations\": %zu, \"ns_per_op\": %.2f, \"allocs_per_op\": %.2f, \"bytes_per_op\": %.1f}",
+                  name.c_str(), iterations, ns / iterations,
+                  (double)(allocCount - allocsBefore) / iterations, (double)(allocBytes - bytesBefore) / iterations);
+    results.push_back(line);
+}
+
+template<typename Map>
+static void benchStringMap(const char *family, const Map &map)
+{
+    std::vector<std::string_view> names;
+    std::vector<int> indices;
+    for(auto &entry : map) {
+        names.push_back(entry.first);
+        indices.push_back(entry.second);
+    }
+
+    bench(std::string(family) + "/name_to_index", 100000, [&] {
+        for(auto &name : names)
+            keep(map.find(name)->second);
+    });
+    // the tables are keyed by name, so going the other way is a scan
+    bench(std::string(family) + "/index_to_name", 100000, [&] {
+        for(int index : indices)
+            for(auto &entry : map)
+                if(entry.second == index) { keep(entry.first.size()); break; }
+    });
+}
+
+int main()
+{
+    bench("OF_Const/construct", 2000, [] {
+        OF_Const c;
+        keep(c.boardsPresetsMap.size());
+    });
+
+    const OF_Const c;
+    benchStringMap("boardInputs", c.boardInputs_Strings);
+    benchStringMap("boolTypes", c.boolTypes_Strings);
+    benchStringMap("settingsTypes", c.settingsTypes_Strings);
+    benchStringMap("profSettingTypes", c.profSettingTypes_Strings);
+
+    for(auto &board : c.boardsPresetsMap) {
+        const std::string name(board.first);
+        bench("boardsPresetsMap/" + name, 100000, [&] {
+            auto &pins = c.boardsPresetsMap.find(board.first)->second;
+            for(int pin : pins)
+                keep(pin);
+        });
+    }
+
+#ifdef OF_APP
+    benchStringMap("loopSections", c.loopSections_Strings);
+    benchStringMap("latencyStages", c.latencyStages_Strings);
+    benchStringMap("flashOps", c.flashOps_Strings);
+    benchStringMap("bootPhases", c.bootPhases_Strings);
+
+    bench("boardInputs/index_to_name_descs", 100000, [&] {
+        for(int func = OF_Const::btnUnmapped; func < OF_Const::boardInputsCount; ++func)
+            keep(OF_Const::boardInputs_Descs[func+1].name.size());
+    });
+
+    for(auto &board : c.boardsBoxPositions) {
+        const std::string name(board.first);
+        bench("boardsBoxPositions/" + name, 100000, [&] {
+            for(unsigned int pos : c.boardsBoxPositions.find(board.first)->second)
+                keep(pos & OF_Const::posCheck);
+        });
+        bench("boardsBoxLayouts/" + name, 100000, [&] {
+            auto &layout = c.boardsBoxLayouts.find(board.first)->second;
+            for(auto side : {&layout.left, &layout.right, &layout.middle})
+                for(auto &box : *side)
+                    keep(box.pin);
+        });
+    }
+
+    for(auto &caps : c.mcuCapableMaps) {
+        const std::string name(caps.first);
+        bench("mcuCapableMaps/" + name, 100000, [&] {
+            for(int cap : c.mcuCapableMaps.find(caps.first)->second)
+                keep(cap);
+        });
+    }
+
+    for(auto &board : c.boardsAltPresetsIndex) {
+        const std::string name(board.first);
+        bench("altPresetsFor/" + name, 100000, [&] {
+            for(auto &preset : c.altPresetsFor(board.first))
+                keep(preset.pin.size());
+        });
+    }
+
+    const OF_Const filter;
+    bench("pinsAllowedFunctions/cached", 100000, [&] {
+        keep(filter.pinsAllowedFunctions("rpipico", filter.boardArchs[OF_Const::boardRP]).size());
+    });
+    // includes constructing OF_Const - compare with OF_Const/construct
+    bench("pinsAllowedFunctions/first_use", 200, [&] {
+        const OF_Const fresh;
+        keep(fresh.pinsAllowedFunctions("rpipico", fresh.boardArchs[OF_Const::boardRP]).size());
+    });
+    bench("pinsAllowedFunctions/board_change", 100000, [&] {
+        keep(filter.pinsAllowedFunctions("rpipico", filter.boardArchs[OF_Const::boardRP]).size());
+        keep(filter.pinsAllowedFunctions("esp32-s3-devkitc-1", filter.boardArchs[OF_Const::boardESP32_S3]).size());
+    });
+#endif // OF_APP
+
+#ifdef OF_APP
+    std::printf("{\n  \"config\": \"app\",\n  \"benchmarks\": [\n");
+#else
+    std::printf("{\n  \"config\": \"firmware\",\n  \"benchmarks\": [\n");
+#endif
+    for(size_t i = 0; i < results.size(); ++i)
+        std::printf("%s%s\n", results[i].c_str(), i + 1 < results.size() ? "," : "");
+    std::printf("  ]\n}\n");
+    return 0;
+}
@@ -0,0 +1,126 @@
+/*!
+* @file  ofFootprint.cpp
+* @brief Memory footprint report for the tables in OpenFIREshared.h
+*
+* Build & run once per configuration, e.g.:
+*   g++ -std=c++17 -I.. ofFootprint.cpp -o ofFootprint && ./ofFootprint
+*   g++ -std=c++17 -I.. -DOF_APP ofFootprint.cpp -o ofFootprint-app && ./ofFootprint-app
+*
+* Lists the static size of OF_Const, the heap it allocates on construction, and the heap, element and
+* bucket counts of each table. Heap use per table is measured by copying it while counting allocations,
+* so it reflects this host's standard library (32-bit MCU targets use roughly half for pointers/size_t).
+*
+* Options:
+*   --budget-static N   fail if sizeof(OF_Const) exceeds N bytes
+*   --budget-heap N     fail if OF_Const construction allocates more than N bytes
+*
+* Exits with 1 if any budget is exceeded.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "OpenFIREshared.h"
+#include "allocCounter.h"
+
+// copies a table while counting the allocations it takes
+template<typename T>
+static void report(const char *name, const T &table, size_t buckets)
+{
+    const size_t count = allocCount, bytes = allocBytes;
+    {
+        T copy(table);
+        (void)copy;
+    }
+    std::printf("  %-26s %8zu %10zu %10zu %10zu\n", name, allocBytes - bytes, allocCount - count, table.size(), buckets);
+}
+
+template<typename T>
+static void reportMap(const char *name, const T &table)
+{
+    report(name, table, table.bucket_count());
+}
+
+template<typename T>
+static void reportList(const char *name, const T &table)
+{
+    report(name, table, 0);
+}
+
+int main(int argc, char **argv)
+{
+    size_t budgetStatic = 0, budgetHeap = 0;
+    for(int i = 1; i + 1 < argc; i += 2) {
+        if(!std::strcmp(argv[i], "--budget-static"))
+            budgetStatic = std::strtoul(argv[i+1], nullptr, 10);
+        else if(!std::strcmp(argv[i], "--budget-heap"))
+            budgetHeap = std::strtoul(argv[i+1], nullptr, 10);
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if(argc % 2 == 0) {
+        std::fprintf(stderr, "Usage: %s [--budget-static N] [--budget-heap N]\n", argv[0]);
+        return 2;
+    }
+
+    const size_t count = allocCount, bytes = allocBytes;
+    const OF_Const *c = new OF_Const;
+    const size_t heap = allocBytes - bytes - sizeof(OF_Const), allocs = allocCount - count - 1;
+
+#ifdef OF_APP
+    std::printf("OF_Const footprint (OF_APP)\n");
+#else
+    std::printf("OF_Const footprint (firmware)\n");
+#endif
+    std::printf("  static size:         %zu bytes\n", sizeof(OF_Const));
+    std::printf("  heap on construction: %zu bytes in %zu allocations\n\n", heap, allocs);
+    std::printf("  %-26s %8s %10s %10s %10s\n", "table", "heap", "allocs", "elements", "buckets");
+
+    reportMap("boardInputs_Strings", c->boardInputs_Strings);
+    reportMap("boolTypes_Strings", c->boolTypes_Strings);
+    reportMap("settingsTypes_Strings", c->settingsTypes_Strings);
+    reportMap("profSettingTypes_Strings", c->profSettingTypes_Strings);
+    reportMap("boardsPresetsMap", c->boardsPresetsMap);
+#ifdef OF_APP
+    reportList("boardNames", c->boardNames);
+    reportMap("loopSections_Strings", c->loopSections_Strings);
+    reportMap("latencyStages_Strings", c->latencyStages_Strings);
+    reportMap("flashOps_Strings", c->flashOps_Strings);
+    reportMap("bootPhases_Strings", c->bootPhases_Strings);
+    reportMap("mcuCapableMaps", c->mcuCapableMaps);
+    reportMap("boardsBoxPositions", c->boardsBoxPositions);
+    reportMap("boardsBoxLayouts", c->boardsBoxLayouts);
+    reportList("boardsAltPresets", c->boardsAltPresets);
+    reportMap("boardsAltPresetsIndex", c->boardsAltPresetsIndex);
+#endif // OF_APP
+
+    int status = 0;
+    if(budgetStatic && sizeof(OF_Const) > budgetStatic) {
+        std::printf("\nFAIL: static size %zu exceeds budget of %zu bytes\n", sizeof(OF_Const), budgetStatic);
+        status = 1;
+    }
+    if(budgetHeap && heap > budgetHeap) {
+        std::printf("\nFAIL: construction heap %zu exceeds budget of %zu bytes\n", heap, budgetHeap);
+        status = 1;
+    }
+    delete c;
+    return status;
+}
@@ -0,0 +1,52 @@
+#!/usr/bin/env python3
+#
+# ofSharedEnums.py - reads the enums in OpenFIREshared.h, so host tools decode board data
+# with the same names and values the firmware and apps are built with.
+#
+# Usage (as a module): from ofSharedEnums import shared_enum
+#                      buttons = shared_enum('boardInputs_e')   # {'btnTrigger': 0, ...}
+#
+# Copyright That One Seong, 2025
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+import os
+import re
+
+HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', 'OpenFIREshared.h')
+ENUM = re.compile(r'enum\s*\{([^}]*)\}\s*(\w+)\s*;')
+ENTRY = re.compile(r'^\s*(\w+)\s*(?:=\s*(-?(?:0[xX][0-9a-fA-F]+|\d+)))?\s*$')
+
+_enums = None
+
+
+def parse_enums(text):
+    """Returns {enum name: {entry: value}} for every named anonymous enum in text."""
+    text = re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.S)
+    enums = {}
+    for body, name in ENUM.findall(text):
+        values, value = {}, -1
+        for entry in body.split(','):
+            m = ENTRY.match(entry)
+            if not m:
+                continue
+            value = int(m.group(2), 0) if m.group(2) else value + 1
+            values[m.group(1)] = value
+        enums[name] = values
+    return enums
+
+
+def shared_enum(name, header=HEADER):
+    """Returns {entry: value} for one of OpenFIREshared.h's enums, e.g. 'traceEvents_e'."""
+    global _enums
+    if _enums is None:
+        with open(header, encoding='utf-8') as f:
+            _enums = parse_enums(f.read())
+    return _enums[name]
+
+
+def names_of(name, header=HEADER):
+    """Returns {value: entry} for one of OpenFIREshared.h's enums (first entry wins on duplicates)."""
+    names = {}
+    for entry, value in shared_enum(name, header).items():
+        names.setdefault(value, entry)
+    return names
@@ -0,0 +1,364 @@
+/*!
+* @file  serialFuzz.cpp
+* @brief Robustness and throughput harness for the serial frame decoder in OpenFIREserial.h
+*
+* Standalone (any compiler):
+*   g++ -std=c++17 -O2 -I.. serialFuzz.cpp -o serialFuzz
+*   ./serialFuzz [--corpus dir] [--write-corpus dir] [--iterations N] [--seed N]
+*
+*   Replays a corpus of sessions (built-in dock, commit and telemetry sessions, plus every file in --corpus,
+*   e.g. raw serial captures saved by the app), reports decode throughput in MB/s, then fuzzes the decoder
+*   with random mutations of the corpus (bit flips, truncation, splices and ASCII 33-127 noise).
+*   --write-corpus saves the built-in sessions as seed files.
+*
+* Coverage-guided (clang):
+*   clang++ -std=c++17 -g -O1 -fsanitize=fuzzer,address,undefined -DOF_LIBFUZZER -I.. serialFuzz.cpp -o serialFuzz
+*   ./serialFuzz corpusDir
+*
+* Either way, every input is checked against the decoder's invariants - once with a decoder large enough for every frame,
+* and once with a small one that has to drop and skip the larger frames - and the run aborts on the first violation.
+*
+* @copyright That One Seong, 2025
+*
+*  OpenFIREshared is free software: you can redistribute it and/or modify
+*  it under the terms of the GNU General Public License as published by
+*  the Free Software Foundation, either version 3 of the License, or
+*  (at your option) any later version.
+*
+*  This program is distributed in the hope that it will be useful,
+*  but WITHOUT ANY WARRANTY; without even the implied warranty of
+*  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*  GNU General Public License for more details.
+*
+*  You should have received a copy of the GNU General Public License
+*  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "OpenFIREserial.h"
+
+typedef std::vector<uint8_t> bytes_t;
+
+static constexpr size_t maxPayload = 4608; // a full 512-record sTraceDump
+static constexpr size_t smallPayload = 64;  // small enough that trace dumps & stats are overlong
+
+//// Invariants
+
+static void fail(const char *what, uint8_t code)
+{
+    std::fprintf(stderr, "serialFuzz: invariant broken: %s (code 0x%02X)\n", what, code);
+    std::abort();
+}
+
+// decodes one input in arbitrary chunks and checks every frame against its command's layout
+template<size_t MaxPayload>
+static OF_SerialDecoder<MaxPayload> check(const uint8_t *data, size_t len)
+{
+    OF_SerialDecoder<MaxPayload> decoder;
+    size_t frames = 0, payloadBytes = 0, terminators = 0;
+    auto onFrame = [&](uint8_t code, const uint8_t *payload, size_t size) {
+        const OF_Const::serialLayout_t layout = OF_Const::serialLayout(code);
+        if(layout.kind == OF_Const::serialUnassigned)
+            fail("frame with an unassigned code", code);
+        if(layout.kind == OF_Const::serialTerminated) {
+            if(size > MaxPayload || std::memchr(payload, OF_Const::serialTerminator, size))
+                fail("terminated payload is too long or runs past its terminator", code);
+            ++terminators;
+        }
+        if(layout.kind == OF_Const::serialFramed &&
+           (size < layout.head || size > MaxPayload || OF_Const::serialPayloadSize(layout, payload) != size))
+            fail("payload doesn't match its layout", code);
+        ++frames;
+        payloadBytes += size;
+    };
+
+    // split into uneven chunks, as a UART would deliver them
+    size_t at = 0, chunk = 1;
+    while(at < len) {
+        const size_t n = chunk < len - at ? chunk : len - at;
+        decoder.feed(data + at, n, onFrame);
+        at += n;
+        chunk = chunk * 3 % 61 + 1;
+    }
+    decoder.reset();
+
+    if(frames != decoder.frames)
+        fail("frame count doesn't match the callbacks", 0);
+    // every byte is a code, a payload byte, a terminator, noise, or part of a dropped frame
+    if(frames + payloadBytes + terminators + decoder.badCodes > len)
+        fail("decoded more bytes than were fed", 0);
+    return decoder;
+}
+
+// checks an input with both a decoder that fits every frame and one that has to drop the large ones
+static void checkBoth(const uint8_t *data, size_t len)
+{
+    check<maxPayload>(data, len);
+    check<smallPayload>(data, len);
+}
+
+#ifdef OF_LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t len)
+{
+    checkBoth(data, len);
+    return 0;
+}
+
+#else
+
+// keeps results alive so the optimiser can't drop the work being measured
+static volatile uintptr_t sink;
+static void keep(uintptr_t value) { sink = sink + value; }
+
+//// Built-in sessions
+
+static void frame(bytes_t &out, uint8_t code, const bytes_t &payload = {})
+{
+    uint8_t buf[2 + maxPayload];
+    const size_t n = OF_Const::serialEncode(code, payload.data(), payload.size(), buf);
+    if(!n) {
+        std::fprintf(stderr, "serialFuzz: built-in session has a bad 0x%02X frame\n", code);
+        std::exit(2);
+    }
+    out.insert(out.end(), buf, buf + n);
+}
+
+// app docks and reads back everything
+static bytes_t dockSession()
+{
+    bytes_t s;
+    frame(s, OF_Const::sDock1);
+    frame(s, OF_Const::sDock2);
+    for(uint8_t code : {OF_Const::sGetPins, OF_Const::sGetToggles, OF_Const::sGetSettings, OF_Const::sGetBtns,
+                        OF_Const::sGetErrorStats, OF_Const::sGetTrace})
+        frame(s, code);
+    frame(s, OF_Const::serialTerminator);
+    return s;
+}
+
+// app pushes toggles, settings, a whole pin map and a profile, then a preset as pin changes, then saves
+static bytes_t commitSession()
+{
+    const OF_Const c;
+    const std::vector<int> &from = c.boardsPresetsMap.at("rpipico"), &to = c.boardsPresetsMap.at("adafruitItsyRP2040");
+    bytes_t s, payload;
+    frame(s, OF_Const::sCommitStart);
+
+    for(int toggle = 0; toggle < OF_Const::boolTypesCount; ++toggle)
+        payload.insert(payload.end(), { (uint8_t)toggle, (uint8_t)(toggle & 1) });
+    frame(s, OF_Const::sCommitToggles, payload);
+
+    payload.clear();
+    for(int setting = 0; setting < OF_Const::settingsTypesCount; ++setting)
+        payload.insert(payload.end(), { (uint8_t)setting, (uint8_t)(setting * 10), 0 });
+    frame(s, OF_Const::sCommitSettings, payload);
+
+    payload.clear();
+    // unavailable (-2) would be sent as serialTerminator - those pins can't be mapped anyway
+    for(size_t pin = 0; pin < from.size(); ++pin)
+        if(from[pin] != OF_Const::unavailable)
+            payload.insert(payload.end(), { (uint8_t)pin, (uint8_t)from[pin] });
+    frame(s, OF_Const::sCommitPins, payload);
+
+    payload = { 0 };
+    for(int setting = 0; setting < OF_Const::profIrLayout; ++setting)
+        payload.insert(payload.end(), { (uint8_t)setting, (uint8_t)(setting * 20), 0 });
+    frame(s, OF_Const::sCommitProfile, payload);
+
+    OF_Const::pinChange_t changes[30];
+    const size_t count = OF_Const::pinsDiff(from.data(), to.data(), 30, changes);
+    payload = { (uint8_t)count };
+    for(size_t i = 0; i < count; ++i) {
+        payload.push_back(changes[i].pin);
+        payload.push_back((uint8_t)changes[i].to);
+    }
+    frame(s, OF_Const::sCommitPinChanges, payload);
+    frame(s, OF_Const::sSave);
+    frame(s, OF_Const::serialTerminator);
+    return s;
+}
+
+// board streams stats, IR frames and errors during sIRTest / sIRCapture
+static bytes_t telemetrySession()
+{
+    bytes_t s;
+    uint8_t buf[256];
+    frame(s, OF_Const::sIRTest);
+    frame(s, OF_Const::sGetLoopStats, { 5 });
+
+    OF_Const::irTraceHeader_t header = { OF_Const::irTraceVersion, {} };
+    frame(s, OF_Const::sIRTraceHeader, bytes_t(buf, buf + OF_Const::irTraceHeaderEncode(header, buf)));
+    for(uint32_t i = 0; i < 200; ++i) {
+        const OF_Const::irFrame_t ir = { i * 4800, 0x0F, { 100, 900, 100, 900 }, { 100, 100, 700, 700 } };
+        frame(s, OF_Const::sIRFrameUpd, bytes_t(buf, buf + OF_Const::irFrameEncode(ir, buf)));
+
+        if(i % 20 == 0) {
+            OF_Const::timingStat_t stats[OF_Const::loopSectionsCount] = {};
+            bytes_t payload = { OF_Const::loopSectionsCount };
+            const size_t n = OF_Const::timingStatsEncode(stats, OF_Const::loopSectionsCount, buf);
+            payload.insert(payload.end(), buf, buf + n);
+            frame(s, OF_Const::sLoopStatsUpd, payload);
+        }
+        if(i % 50 == 0) {
+            const size_t n = OF_Const::errorEncode(OF_Const::sErrCam, i, buf);
+            s.insert(s.end(), buf, buf + n);
+        }
+    }
+
+    OF_Const::errorStat_t error = { OF_Const::sErrCam, 4, 0, 950, 0, 2 };
+    bytes_t payload = { 1 };
+    payload.insert(payload.end(), buf, buf + OF_Const::errorStatsEncode(&error, 1, buf));
+    frame(s, OF_Const::sErrorStats, payload);
+
+    // a full default-sized dump, which the firmware's decoders can't fit and have to skip
+    payload.assign(buf, buf + OF_Const::traceHeaderEncode(512, 0, buf));
+    for(uint32_t i = 0; i < 512; ++i)
+        payload.insert(payload.end(), buf, buf + OF_Const::traceRecordEncode({ i * 100, OF_Const::traceMark, 0, 0 }, buf));
+    frame(s, OF_Const::sTraceDump, payload);
+    frame(s, OF_Const::serialTerminator);
+    return s;
+}
+
+static bool readFile(const std::string &path, bytes_t &out)
+{
+    FILE *f = std::fopen(path.c_str(), "rb");
+    if(!f) return false;
+    uint8_t buf[4096];
+    size_t n;
+    while((n = std::fread(buf, 1, sizeof(buf), f)))
+        out.insert(out.end(), buf, buf + n);
+    std::fclose(f);
+    return true;
+}
+
+static bool writeFile(const std::string &path, const bytes_t &data)
+{
+    FILE *f = std::fopen(path.c_str(), "wb");
+    if(!f) return false;
+    std::fwrite(data.data(), 1, data.size(), f);
+    std::fclose(f);
+    return true;
+}
+
+//// Mutations
+
+static bytes_t mutate(const std::vector<bytes_t> &corpus, std::mt19937 &rng)
+{
+    bytes_t s = corpus[rng() % corpus.size()];
+    const int edits = 1 + rng() % 8;
+    for(int e = 0; e < edits && !s.empty(); ++e) {
+        const size_t at = rng() % s.size();
+        switch(rng() % 5) {
+        case 0: s[at] ^= 1 << (rng() % 8); break;                           // bit flip
+        case 1: s.resize(at); break;                                        // truncation
+        case 2: s.insert(s.begin() + at, (uint8_t)(33 + rng() % 95)); break;// ASCII noise
+        case 3: s.insert(s.begin() + at, (uint8_t)rng()); break;            // random byte
+        default: {                                                          // splice in part of another session
+            const bytes_t &other = corpus[rng() % corpus.size()];
+            const size_t from = rng() % other.size(), n = rng() % (other.size() - from) + 1;
+            s.insert(s.begin() + at, other.begin() + from, other.begin() + from + n);
+        }
+        }
+    }
+    return s;
+}
+
+int main(int argc, char **argv)
+{
+    std::vector<std::string> corpusDirs;
+    const char *writeDir = nullptr;
+    unsigned long iterations = 200000, seed = 1;
+    for(int i = 1; i + 1 < argc; i += 2) {
+        if(!std::strcmp(argv[i], "--corpus")) corpusDirs.push_back(argv[i+1]);
+        else if(!std::strcmp(argv[i], "--write-corpus")) writeDir = argv[i+1];
+        else if(!std::strcmp(argv[i], "--iterations")) iterations = std::strtoul(argv[i+1], nullptr, 10);
+        else if(!std::strcmp(argv[i], "--seed")) seed = std::strtoul(argv[i+1], nullptr, 10);
+        else {
+            std::fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+    if(argc % 2 == 0) {
+        std::fprintf(stderr, "Usage: %s [--corpus dir] [--write-corpus dir] [--iterations N] [--seed N]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<std::pair<std::string, bytes_t>> sessions = {
+        { "dock", dockSession() },
+        { "commit", commitSession() },
+        { "telemetry", telemetrySession() },
+    };
+
+    if(writeDir) {
+        for(auto &session : sessions)
+            if(!writeFile(std::string(writeDir) + "/" + session.first + ".bin", session.second)) {
+                std::fprintf(stderr, "Can't write to %s\n", writeDir);
+                return 2;
+            }
+    }
+
+    // corpus directories are listed with "ls" rather than <filesystem>, for older toolchains
+    for(auto &dir : corpusDirs) {
+        FILE *ls = popen(("ls -1 \"" + dir + "\"").c_str(), "r");
+        char name[512];
+        while(ls && std::fgets(name, sizeof(name), ls)) {
+            name[std::strcspn(name, "\n")] = 0;
+            bytes_t data;
+            if(readFile(dir + "/" + name, data) && !data.empty())
+                sessions.push_back({ dir + "/" + name, data });
+        }
+        if(ls) pclose(ls);
+    }
+
+    // replay: every session must decode with no noise (also when frames have to be dropped), and is timed for throughput
+    std::printf("{\n  \"sessions\": [\n");
+    std::vector<bytes_t> corpus;
+    for(size_t i = 0; i < sessions.size(); ++i) {
+        const bytes_t &data = sessions[i].second;
+        corpus.push_back(data);
+
+        // a clean session has no noise, and a small decoder only loses the frames too big for it
+        const auto decoder = check<maxPayload>(data.data(), data.size());
+        const auto small = check<smallPayload>(data.data(), data.size());
+        if(decoder.badCodes || decoder.overlong || decoder.truncated)
+            fail("clean session didn't decode cleanly", 0);
+        if(small.badCodes || small.truncated || small.frames + small.overlong != decoder.frames)
+            fail("small decoder lost sync on a clean session", 0);
+        const size_t passes = 1 + (16u << 20) / data.size(); // ~16MB per session
+        size_t frames = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for(size_t pass = 0; pass < passes; ++pass) {
+            OF_SerialDecoder<maxPayload> timed;
+            frames += timed.feed(data.data(), data.size(), [](uint8_t code, const uint8_t *, size_t n) { keep(code + n); });
+        }
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("    {\"name\": \"%s\", \"bytes\": %zu, \"frames\": %u, \"overlong_at_%zu\": %u, \"mb_per_s\": %.1f, \"frames_per_s\": %.0f}%s\n",
+                    sessions[i].first.c_str(), data.size(), decoder.frames, smallPayload, small.overlong,
+                    passes * data.size() / seconds / 1e6, frames / seconds, i + 1 < sessions.size() ? "," : "");
+    }
+    std::printf("  ],\n");
+
+    // fuzz: mutated sessions must never break an invariant
+    std::mt19937 rng(seed);
+    size_t fuzzBytes = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for(unsigned long i = 0; i < iterations; ++i) {
+        const bytes_t input = mutate(corpus, rng);
+        checkBoth(input.data(), input.size());
+        fuzzBytes += input.size();
+    }
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("  \"fuzz\": {\"iterations\": %lu, \"seed\": %lu, \"bytes\": %zu, \"seconds\": %.2f}\n}\n",
+                iterations, seed, fuzzBytes, seconds);
+    return 0;
+}
+
+#endif // OF_LIBFUZZER
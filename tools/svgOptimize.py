@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+#
+# svgOptimize.py - deterministic size optimisation pass for the board vectors in boardPics/
+#
+# For every board listed in boards.qrc this:
+#  - strips editor namespaces and data (sodipodi:*, inkscape:*, <metadata>, comments),
+#  - drops ids that nothing references (OF* ids are always kept),
+#  - rounds path/shape coordinates to a fixed number of decimals,
+#  - unwraps groups that carry no attributes (i.e. static layers with no effect on rendering),
+#  - re-wraps embedded base64 rasters without line breaks, and optionally re-encodes JPEGs (needs Pillow),
+# then checks that the OF_pinX highlight contract still holds (same pins, opacity:0, same bounding boxes)
+# and reports the size and parse-time difference per board.
+#
+# Output is written one attribute per line for highlight elements, so the id="OF_pinX" line stays
+# above the style="" line as the README requires; everything else is written compactly.
+#
+# Usage: python3 tools/svgOptimize.py [--write] [--decimals 3] [--jpeg-quality N]
+#        (without --write, only the report is printed)
+#
+# Copyright That One Seong, 2025
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+import argparse
+import base64
+import io
+import os
+import re
+import sys
+import time
+import xml.etree.ElementTree as ET
+from xml.sax.saxutils import escape, quoteattr
+
+from svgPinIndex import NUMBER, PIN_ID, SVG_NS, path_points, read_qrc, scan_pins
+
+XLINK_NS = 'http://www.w3.org/1999/xlink'
+XML_NS = 'http://www.w3.org/XML/1998/namespace'
+EDITOR_NS = (
+    'http://sodipodi.sourceforge.net/DTD/sodipodi-0.dtd',
+    'http://www.inkscape.org/namespaces/inkscape',
+    'http://www.w3.org/1999/02/22-rdf-syntax-ns#',
+    'http://creativecommons.org/ns#',
+    'http://purl.org/dc/elements/1.1/',
+)
+GEOMETRY_ATTRS = ('x', 'y', 'width', 'height', 'cx', 'cy', 'r', 'rx', 'ry', 'x1', 'y1', 'x2', 'y2')
+TEXT_TAGS = ('text', 'tspan', 'textPath', 'style')
+BBOX_TOLERANCE = 0.05  # in percent of the document's larger viewBox side
+
+
+def ns_of(name):
+    return name[1:].split('}')[0] if name.startswith('{') else ''
+
+
+def local(name):
+    return name.split('}')[-1]
+
+
+##### Number rounding
+
+def fmt_num(v, decimals):
+    s = ('%.*f' % (decimals, v)).rstrip('0').rstrip('.') if decimals else '%d' % round(v)
+    if s in ('-0', ''):
+        s = '0'
+    # leading zeros aren't needed by any SVG number grammar
+    if s.startswith('0.'):
+        s = s[1:]
+    elif s.startswith('-0.'):
+        s = '-' + s[2:]
+    return s
+
+
+def round_numbers(text, decimals):
+    """Rounds every number in an attribute value, keeping adjacent numbers unambiguous."""
+    out = []
+    last = 0
+    for m in NUMBER.finditer(text):
+        sep = text[last:m.start()]
+        num = fmt_num(float(m.group(0)), decimals)
+        if not sep and out:
+            prev = out[-1]
+            # "1.5.5" is two numbers, but "1" + ".5" or "1.5" + "0" would merge into one
+            if num[0].isdigit() or (num[0] == '.' and '.' not in prev and 'e' not in prev.lower()):
+                sep = ' '
+        out.append(sep)
+        out.append(num)
+        last = m.end()
+    out.append(text[last:])
+    return ''.join(out)
+
+
+def round_path(d, decimals):
+    try:
+        for _ in path_points(d):
+            pass
+    except (ValueError, IndexError):
+        return d  # unusual syntax (e.g. compact arc flags); leave untouched rather than risk corrupting it
+    return round_numbers(d, decimals).replace(', ', ',')
+
+
+##### Tree passes
+
+def referenced_ids(root):
+    refs = set()
+    for el in root.iter():
+        for k, v in el.attrib.items():
+            refs.update(re.findall(r'url\(\s*#([^)\s]+)\s*\)', v))
+            if local(k) == 'href' and v.startswith('#'):
+                refs.add(v[1:])
+        if el.text and local(el.tag) == 'style':
+            refs.update(re.findall(r'url\(\s*#([^)\s]+)\s*\)', el.text))
+    return refs
+
+
+def strip(el, refs, decimals, stats, jpeg_quality):
+    for child in list(el):
+        if not isinstance(child.tag, str) or ns_of(child.tag) in EDITOR_NS or local(child.tag) == 'metadata':
+            el.remove(child)
+            continue
+        strip(child, refs, decimals, stats, jpeg_quality)
+
+    for k in list(el.attrib):
+        if ns_of(k) in EDITOR_NS:
+            del el.attrib[k]
+    ident = el.get('id')
+    if ident is not None and not ident.startswith('OF') and ident not in refs:
+        del el.attrib['id']
+
+    tag = local(el.tag)
+    if tag == 'path' and 'd' in el.attrib:
+        el.set('d', round_path(el.get('d'), decimals))
+    elif tag in ('polygon', 'polyline') and 'points' in el.attrib:
+        el.set('points', round_numbers(el.get('points'), decimals))
+    for k in GEOMETRY_ATTRS:
+        if k in el.attrib and not el.get(k).endswith('%'):
+            el.set(k, round_numbers(el.get(k), decimals))
+    if 'transform' in el.attrib:
+        # transforms scale everything beneath them, so keep more precision here
+        el.set('transform', round_numbers(el.get('transform'), decimals + 3))
+
+    if tag == 'image':
+        for k in ('href', '{%s}href' % XLINK_NS):
+            if el.get(k, '').startswith('data:'):
+                el.set(k, repack_raster(el.get(k), stats, jpeg_quality))
+
+
+def repack_raster(uri, stats, jpeg_quality):
+    head, _, data = uri.partition(',')
+    raw = base64.b64decode(re.sub(r'\s+', '', data))
+    if jpeg_quality and 'image/jpeg' in head:
+        try:
+            from PIL import Image
+            buf = io.BytesIO()
+            Image.open(io.BytesIO(raw)).save(buf, 'JPEG', quality=jpeg_quality, optimize=True, progressive=True)
+            if len(buf.getvalue()) < len(raw):
+                raw = buf.getvalue()
+                stats['rasters'] += 1
+        except ImportError:
+            stats['notes'].add('Pillow not installed, embedded JPEGs were not re-encoded')
+    return head + ',' + base64.b64encode(raw).decode('ascii')
+
+
+def unwrap_groups(el):
+    """Hoists the children of attribute-less groups into their parent (repeatedly)."""
+    i = 0
+    while i < len(el):
+        child = el[i]
+        unwrap_groups(child)
+        if local(child.tag) == 'g' and not child.attrib and not (child.text or '').strip():
+            el.remove(child)
+            for j, grandchild in enumerate(list(child)):
+                el.insert(i + j, grandchild)
+            continue
+        i += 1
+
+
+##### Serializer
+
+def qname(name, prefixes):
+    ns = ns_of(name)
+    if not ns or ns == SVG_NS[1:-1]:
+        return local(name)
+    return prefixes[ns] + ':' + local(name)
+
+
+def serialize(root, prefixes):
+    out = ['<?xml version="1.0" encoding="UTF-8" standalone="no"?>\n']
+
+    def write(el, depth, keep_space):
+        tag = qname(el.tag, prefixes)
+        attrs = [(qname(k, prefixes), v) for k, v in el.attrib.items()]
+        if el is root:
+            attrs = [('xmlns', SVG_NS[1:-1])] + [('xmlns:' + p, ns) for ns, p in sorted(prefixes.items(), key=lambda i: i[1])
+                                                 if any(ns_of(n) == ns for e in root.iter() for n in [e.tag, *e.attrib])] + attrs
+        keep_space = keep_space or local(el.tag) in TEXT_TAGS or el.get('{%s}space' % XML_NS) == 'preserve'
+        pad = '' if keep_space else '\n' + ' ' * depth
+        if PIN_ID.match(el.get('id', '')):
+            inner = '\n' + ' ' * (depth + 2)
+            out.append(pad + '<' + tag + ''.join(inner + k + '=' + quoteattr(v) for k, v in attrs))
+        else:
+            out.append(pad + '<' + tag + ''.join(' ' + k + '=' + quoteattr(v) for k, v in attrs))
+        text = el.text or ''
+        if not keep_space:
+            text = text.strip()
+        if not len(el) and not text:
+            out.append('/>')
+        else:
+            out.append('>' + escape(text))
+            for child in el:
+                write(child, depth + 1, keep_space)
+                tail = child.tail or ''
+                out.append(escape(tail if keep_space else tail.strip()))
+            if len(el) and not keep_space:
+                out.append('\n' + ' ' * depth)
+            out.append('</' + tag + '>')
+
+    write(root, 0, False)
+    return ''.join(out).replace('?>\n\n', '?>\n', 1) + '\n'
+
+
+##### Pipeline
+
+def optimize(path, decimals, jpeg_quality):
+    prefixes = {XLINK_NS: 'xlink', XML_NS: 'xml'}
+    for _, (prefix, uri) in ET.iterparse(path, events=('start-ns',)):
+        if prefix and uri not in prefixes and uri not in EDITOR_NS and uri != SVG_NS[1:-1]:
+            prefixes[uri] = prefix
+    root = ET.parse(path).getroot()
+    stats = {'rasters': 0, 'notes': set()}
+    strip(root, referenced_ids(root), decimals, stats, jpeg_quality)
+    unwrap_groups(root)
+    return serialize(root, prefixes), stats
+
+
+def parse_time(data, runs=5):
+    best = None
+    for _ in range(runs):
+        t = time.perf_counter()
+        ET.fromstring(data)
+        t = time.perf_counter() - t
+        best = t if best is None else min(best, t)
+    return best * 1000
+
+
+def verify(path, text):
+    """Raises ValueError if the optimised document no longer matches the original's pin highlights."""
+    vb, before = scan_pins(path)
+    tmp = path + '.tmp'
+    with open(tmp, 'w', newline='\n') as f:
+        f.write(text)
+    try:
+        _, after = scan_pins(tmp)
+    finally:
+        os.remove(tmp)
+    if before.keys() != after.keys():
+        raise ValueError('%s: highlight pins changed (%s -> %s)' % (path, sorted(before), sorted(after)))
+    tol = max(vb[2], vb[3]) * BBOX_TOLERANCE / 100
+    for gpio, pin in before.items():
+        if pin['id'] != after[gpio]['id'] or any(abs(a - b) > tol for a, b in zip(pin['bbox'], after[gpio]['bbox'])):
+            raise ValueError('%s: highlight for GPIO %d moved after optimising' % (path, gpio))
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser()
+    ap.add_argument('--qrc', default=os.path.join(here, '..', 'boardPics', 'boards.qrc'))
+    ap.add_argument('--decimals', type=int, default=3, help='decimal places kept for coordinates (default 3)')
+    ap.add_argument('--jpeg-quality', type=int, default=0, help='re-encode embedded JPEGs at this quality (needs Pillow)')
+    ap.add_argument('--write', action='store_true', help='overwrite the board vectors with the optimised output')
+    args = ap.parse_args()
+
+    notes = set()
+    total = [0, 0]
+    print('%-26s %10s %10s %7s %9s %9s' % ('board', 'bytes', 'optimised', 'saved', 'parse ms', 'opt. ms'))
+    for alias, path in read_qrc(args.qrc):
+        with open(path, 'rb') as f:
+            original = f.read()
+        try:
+            text, stats = optimize(path, args.decimals, args.jpeg_quality)
+            verify(path, text)
+        except (ValueError, ET.ParseError) as e:
+            sys.exit('svgOptimize: ' + str(e))
+        data = text.encode('utf-8')
+        notes |= stats['notes']
+        total[0] += len(original)
+        total[1] += len(data)
+        print('%-26s %10d %10d %6.1f%% %9.2f %9.2f' % (alias, len(original), len(data),
+                                                      100 - 100 * len(data) / len(original),
+                                                      parse_time(original), parse_time(data)))
+        if args.write and data != original:
+            with open(path, 'wb') as f:
+                f.write(data)
+    print('%-26s %10d %10d %6.1f%%' % ('total', total[0], total[1], 100 - 100 * total[1] / total[0]))
+    for note in sorted(notes):
+        print('note: ' + note)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,396 @@
+#!/usr/bin/env python3
+#
+# svgPinIndex.py - builds the pin highlight index for the board vectors in boardPics/
+#
+# Parses every board listed in boards.qrc once, finds the OF_pinX highlight elements
+# and emits a C++ header that Desktop Apps can use to resolve GPIO -> highlight element
+# (ID, bounding box and path data in document coordinates) without searching the SVG DOM.
+#
+# Usage: python3 tools/svgPinIndex.py [--qrc boardPics/boards.qrc] [--out boardPics/boardPicsIndex.h] [--check]
+#
+# Copyright That One Seong, 2025
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+import argparse
+import math
+import os
+import re
+import sys
+import xml.etree.ElementTree as ET
+
+SVG_NS = '{http://www.w3.org/2000/svg}'
+PIN_ID = re.compile(r'^OF_pin(\d+)$')
+OPACITY_ZERO = re.compile(r'(^|;)\s*opacity\s*:\s*0(\.0*)?\s*(;|$)')
+NUMBER = re.compile(r'[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?')
+PATH_TOKEN = re.compile(r'[MmLlHhVvCcSsQqTtAaZz]|[-+]?(?:\d+\.?\d*|\.\d+)(?:[eE][-+]?\d+)?')
+
+IDENTITY = (1.0, 0.0, 0.0, 1.0, 0.0, 0.0)
+
+
+##### Transforms
+
+def mat_mul(m, n):
+    """Returns m * n, where both are SVG (a, b, c, d, e, f) matrices."""
+    a, b, c, d, e, f = m
+    A, B, C, D, E, F = n
+    return (a*A + c*B, b*A + d*B,
+            a*C + c*D, b*C + d*D,
+            a*E + c*F + e, b*E + d*F + f)
+
+
+def mat_apply(m, x, y):
+    a, b, c, d, e, f = m
+    return (a*x + c*y + e, b*x + d*y + f)
+
+
+def parse_transform(text):
+    m = IDENTITY
+    if not text:
+        return m
+    for name, args in re.findall(r'(\w+)\s*\(([^)]*)\)', text):
+        v = [float(n) for n in NUMBER.findall(args)]
+        if name == 'matrix' and len(v) == 6:
+            t = tuple(v)
+        elif name == 'translate':
+            t = (1, 0, 0, 1, v[0], v[1] if len(v) > 1 else 0)
+        elif name == 'scale':
+            t = (v[0], 0, 0, v[1] if len(v) > 1 else v[0], 0, 0)
+        elif name == 'rotate':
+            r = math.radians(v[0])
+            t = (math.cos(r), math.sin(r), -math.sin(r), math.cos(r), 0, 0)
+            if len(v) == 3:
+                t = mat_mul(mat_mul((1, 0, 0, 1, v[1], v[2]), t), (1, 0, 0, 1, -v[1], -v[2]))
+        elif name == 'skewX':
+            t = (1, 0, math.tan(math.radians(v[0])), 1, 0, 0)
+        elif name == 'skewY':
+            t = (1, math.tan(math.radians(v[0])), 0, 1, 0, 0)
+        else:
+            raise ValueError('unsupported transform: ' + name)
+        m = mat_mul(m, t)
+    return m
+
+
+##### Path geometry
+
+def path_points(d, steps=8):
+    """Yields points along an SVG path (endpoints plus curve/arc samples), in path coordinates."""
+    tokens = PATH_TOKEN.findall(d)
+    i = 0
+    cmd = None
+    cx = cy = sx = sy = 0.0
+    qx = qy = None  # last quadratic control point
+    kx = ky = None  # last cubic control point
+
+    def num():
+        nonlocal i
+        v = float(tokens[i])
+        i += 1
+        return v
+
+    while i < len(tokens):
+        if tokens[i].isalpha():
+            cmd = tokens[i]
+            i += 1
+            if cmd in 'Zz':
+                cx, cy = sx, sy
+                yield cx, cy
+                continue
+        elif cmd is None:
+            raise ValueError('path data does not start with a command')
+        rel = cmd.islower()
+        ox, oy = (cx, cy) if rel else (0.0, 0.0)
+        c = cmd.upper()
+        if c == 'M':
+            cx, cy = ox + num(), oy + num()
+            sx, sy = cx, cy
+            cmd = 'l' if rel else 'L'  # subsequent pairs are implicit linetos
+            yield cx, cy
+        elif c == 'L':
+            cx, cy = ox + num(), oy + num()
+            yield cx, cy
+        elif c == 'H':
+            cx = ox + num()
+            yield cx, cy
+        elif c == 'V':
+            cy = oy + num()
+            yield cx, cy
+        elif c in 'CS':
+            if c == 'C':
+                x1, y1 = ox + num(), oy + num()
+            elif kx is not None:
+                x1, y1 = 2*cx - kx, 2*cy - ky
+            else:
+                x1, y1 = cx, cy
+            x2, y2 = ox + num(), oy + num()
+            x, y = ox + num(), oy + num()
+            for s in range(1, steps + 1):
+                t = s / steps
+                u = 1 - t
+                yield (u*u*u*cx + 3*u*u*t*x1 + 3*u*t*t*x2 + t*t*t*x,
+                       u*u*u*cy + 3*u*u*t*y1 + 3*u*t*t*y2 + t*t*t*y)
+            kx, ky = x2, y2
+            cx, cy = x, y
+        elif c in 'QT':
+            if c == 'Q':
+                x1, y1 = ox + num(), oy + num()
+            elif qx is not None:
+                x1, y1 = 2*cx - qx, 2*cy - qy
+            else:
+                x1, y1 = cx, cy
+            x, y = ox + num(), oy + num()
+            for s in range(1, steps + 1):
+                t = s / steps
+                u = 1 - t
+                yield (u*u*cx + 2*u*t*x1 + t*t*x, u*u*cy + 2*u*t*y1 + t*t*y)
+            qx, qy = x1, y1
+            cx, cy = x, y
+        elif c == 'A':
+            rx, ry, rot = abs(num()), abs(num()), num()
+            large, sweep = arc_flag(tokens, i), arc_flag(tokens, i + 1)
+            i += 2
+            x, y = ox + num(), oy + num()
+            yield from arc_points(cx, cy, rx, ry, rot, large, sweep, x, y, steps * 2)
+            cx, cy = x, y
+        if c not in 'CS':
+            kx = ky = None
+        if c not in 'QT':
+            qx = qy = None
+
+
+def arc_flag(tokens, i):
+    # compact flags (e.g. "a1 1 0 01.5.5") would be read as one number by the tokenizer;
+    # none of the board vectors use them, so just refuse rather than guess
+    tok = tokens[i]
+    if tok not in ('0', '1'):
+        raise ValueError('compact arc flags are not supported: ' + tok)
+    return tok == '1'
+
+
+def arc_points(x1, y1, rx, ry, rot, large, sweep, x2, y2, steps):
+    """Samples an endpoint-parameterised SVG arc (SVG 1.1 F.6.5 conversion to center form)."""
+    if rx == 0 or ry == 0 or (x1 == x2 and y1 == y2):
+        yield x2, y2
+        return
+    phi = math.radians(rot)
+    cp, sp = math.cos(phi), math.sin(phi)
+    dx, dy = (x1 - x2) / 2, (y1 - y2) / 2
+    x1p, y1p = cp*dx + sp*dy, -sp*dx + cp*dy
+    lam = (x1p*x1p) / (rx*rx) + (y1p*y1p) / (ry*ry)
+    if lam > 1:
+        rx, ry = rx * math.sqrt(lam), ry * math.sqrt(lam)
+    num = rx*rx*ry*ry - rx*rx*y1p*y1p - ry*ry*x1p*x1p
+    den = rx*rx*y1p*y1p + ry*ry*x1p*x1p
+    co = math.sqrt(max(0.0, num / den)) if den else 0.0
+    if large == sweep:
+        co = -co
+    cxp, cyp = co * rx*y1p / ry, -co * ry*x1p / rx
+    ccx = cp*cxp - sp*cyp + (x1 + x2) / 2
+    ccy = sp*cxp + cp*cyp + (y1 + y2) / 2
+    t1 = math.atan2((y1p - cyp) / ry, (x1p - cxp) / rx)
+    t2 = math.atan2((-y1p - cyp) / ry, (-x1p - cxp) / rx)
+    dt = t2 - t1
+    if sweep and dt < 0:
+        dt += 2*math.pi
+    elif not sweep and dt > 0:
+        dt -= 2*math.pi
+    for s in range(1, steps + 1):
+        t = t1 + dt * s / steps
+        yield (ccx + rx*math.cos(t)*cp - ry*math.sin(t)*sp,
+               ccy + rx*math.cos(t)*sp + ry*math.sin(t)*cp)
+
+
+def shape_path(el):
+    """Returns the path data of a basic shape element, or None if it isn't a shape."""
+    tag = el.tag.replace(SVG_NS, '')
+    f = lambda k: float(el.get(k, '0'))
+    if tag == 'path':
+        return el.get('d', '')
+    if tag == 'circle':
+        cx, cy, r = f('cx'), f('cy'), f('r')
+        return 'M%s,%sA%s,%s 0 1 0 %s,%sA%s,%s 0 1 0 %s,%sZ' % tuple(
+            fmt(v) for v in (cx - r, cy, r, r, cx + r, cy, r, r, cx - r, cy))
+    if tag == 'ellipse':
+        cx, cy, rx, ry = f('cx'), f('cy'), f('rx'), f('ry')
+        return 'M%s,%sA%s,%s 0 1 0 %s,%sA%s,%s 0 1 0 %s,%sZ' % tuple(
+            fmt(v) for v in (cx - rx, cy, rx, ry, cx + rx, cy, rx, ry, cx - rx, cy))
+    if tag == 'rect':
+        x, y, w, h = f('x'), f('y'), f('width'), f('height')
+        return 'M%s,%sh%sv%sh%sZ' % tuple(fmt(v) for v in (x, y, w, h, -w))
+    return None
+
+
+def fmt(v, places=3):
+    s = ('%.*f' % (places, v)).rstrip('0').rstrip('.')
+    return '0' if s in ('-0', '') else s
+
+
+##### Document scan
+
+def view_box(root):
+    vb = root.get('viewBox')
+    if vb:
+        return tuple(float(n) for n in NUMBER.findall(vb))
+    return (0.0, 0.0, float(NUMBER.findall(root.get('width', '0'))[0]),
+            float(NUMBER.findall(root.get('height', '0'))[0]))
+
+
+def scan_pins(path):
+    """Parses one board SVG and returns (viewBox, {gpio: pin dict}).
+
+    Raises ValueError if a highlight breaks the OF_pinX/opacity:0 contract.
+    """
+    root = ET.parse(path).getroot()
+    pins = {}
+
+    def walk(el, ctm):
+        ctm = mat_mul(ctm, parse_transform(el.get('transform')))
+        m = PIN_ID.match(el.get('id', ''))
+        if m:
+            gpio = int(m.group(1))
+            if gpio in pins:
+                raise ValueError('%s: duplicate highlight for GPIO %d' % (path, gpio))
+            if not OPACITY_ZERO.search(el.get('style', '')):
+                raise ValueError('%s: %s is missing opacity:0 in its style' % (path, el.get('id')))
+            d = shape_path(el)
+            if d is None:
+                raise ValueError('%s: %s is not a basic shape' % (path, el.get('id')))
+            pts = [mat_apply(ctm, x, y) for x, y in path_points(d)]
+            xs, ys = [p[0] for p in pts], [p[1] for p in pts]
+            pins[gpio] = {'id': el.get('id'), 'bbox': (min(xs), min(ys), max(xs) - min(xs), max(ys) - min(ys)),
+                          'ctm': ctm, 'd': d}
+        for child in el:
+            walk(child, ctm)
+
+    walk(root, IDENTITY)
+    return view_box(root), pins
+
+
+def read_qrc(qrc):
+    """Returns [(alias, file path)] for every board listed in the resource file, in listed order."""
+    base = os.path.dirname(qrc)
+    out = []
+    for f in ET.parse(qrc).getroot().iter('file'):
+        out.append((f.get('alias') or os.path.splitext(f.text)[0], os.path.join(base, f.text)))
+    return out
+
+
+def qrc_prefix(qrc):
+    res = ET.parse(qrc).getroot().find('qresource')
+    return (res.get('prefix') if res is not None else None) or '/'
+
+
+##### Emitter
+
+def c_str(s):
+    return '"' + s.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+
+def emit(boards, prefix):
+    out = ['// Generated by tools/svgPinIndex.py from boardPics/boards.qrc -- do not edit by hand!',
+           '// Re-run the script whenever a board vector is added or changed.',
+           '',
+           '#ifndef _BOARDPICSINDEX_H_',
+           '#define _BOARDPICSINDEX_H_',
+           '',
+           '#include <cstddef>',
+           '#include <cstdint>',
+           '#include <string_view>',
+           '',
+           '/// @brief      Highlight element for a single GPIO in a board vector',
+           '/// @details    bbox (x, y, w, h) is in the document\'s viewBox coordinates with all transforms applied;',
+           '///             path is the raw element geometry, which is mapped to the document by xform (SVG matrix a-f).',
+           '///             Entries for GPIO without a highlight have a null id.',
+           'typedef struct {',
+           '    const char *id;',
+           '    float bbox[4];',
+           '    float xform[6];',
+           '    const char *path;',
+           '} boardPinHighlight_t;',
+           '',
+           '/// @brief      Catalogue entry for a board vector',
+           '/// @details    Lightweight enough to keep resident; the vector itself is only loaded from resource',
+           '///             (a Qt resource path) when the board is actually shown.',
+           'typedef struct {',
+           '    std::string_view board;',
+           '    const char *resource;',
+           '    uint32_t bytes;',
+           '    float viewBox[4];',
+           '    const boardPinHighlight_t *pins; // indexed by GPIO',
+           '    size_t pinsCount;',
+           '} boardPicIndex_t;',
+           '']
+    for alias, _, (vb, pins) in boards:
+        if not pins:
+            continue
+        out.append('static constexpr boardPinHighlight_t boardPinHighlights_%s[] = {' % ident(alias))
+        for gpio in range(max(pins) + 1):
+            p = pins.get(gpio)
+            if p is None:
+                out.append('    /*%02d*/ {nullptr, {0, 0, 0, 0}, {1, 0, 0, 1, 0, 0}, nullptr},' % gpio)
+            else:
+                out.append('    /*%02d*/ {%s, {%s}, {%s}, %s},' % (
+                    gpio, c_str(p['id']), ', '.join(fmt(v) for v in p['bbox']),
+                    ', '.join(fmt(v, 6) for v in p['ctm']), c_str(p['d'])))
+        out.append('};')
+        out.append('')
+    out.append('/// @brief      Pin highlight index for every board vector in boards.qrc, in resource order')
+    out.append('static constexpr boardPicIndex_t boardPicsIndex[] = {')
+    for alias, size, (vb, pins) in boards:
+        res = c_str(':' + prefix.rstrip('/') + '/' + alias)
+        if pins:
+            out.append('    {%s, %s, %d, {%s}, boardPinHighlights_%s, %d},' % (
+                c_str(alias), res, size, ', '.join(fmt(v) for v in vb), ident(alias), max(pins) + 1))
+        else:
+            out.append('    {%s, %s, %d, {%s}, nullptr, 0},' % (
+                c_str(alias), res, size, ', '.join(fmt(v) for v in vb)))
+    out.append('};')
+    out.append('')
+    out.append('/// @brief      Finds the catalogue entry for a board name as reported by OPENFIRE_BOARD')
+    out.append('/// @return     The matching entry, or the "generic" board\'s entry if there\'s no vector for it')
+    out.append('inline const boardPicIndex_t *boardPicFind(std::string_view board)')
+    out.append('{')
+    out.append('    const boardPicIndex_t *fallback = nullptr;')
+    out.append('    for(const auto &pic : boardPicsIndex) {')
+    out.append('        if(pic.board == board)')
+    out.append('            return &pic;')
+    out.append('        else if(pic.board == "generic")')
+    out.append('            fallback = &pic;')
+    out.append('    }')
+    out.append('    return fallback;')
+    out.append('}')
+    out.append('')
+    out.append('#endif // _BOARDPICSINDEX_H_')
+    return '\n'.join(out) + '\n'
+
+
+def ident(alias):
+    return re.sub(r'\W', '_', alias)
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser(description=__doc__)
+    ap.add_argument('--qrc', default=os.path.join(here, '..', 'boardPics', 'boards.qrc'))
+    ap.add_argument('--out', default=os.path.join(here, '..', 'boardPics', 'boardPicsIndex.h'))
+    ap.add_argument('--check', action='store_true', help='fail if the output file is out of date instead of writing it')
+    args = ap.parse_args()
+
+    try:
+        boards = [(alias, os.path.getsize(path), scan_pins(path)) for alias, path in read_qrc(args.qrc)]
+    except (ValueError, ET.ParseError) as e:
+        sys.exit('svgPinIndex: ' + str(e))
+
+    text = emit(boards, qrc_prefix(args.qrc))
+    if args.check:
+        with open(args.out) as f:
+            if f.read() != text:
+                sys.exit('svgPinIndex: %s is out of date, re-run tools/svgPinIndex.py' % args.out)
+        return
+    with open(args.out, 'w', newline='\n') as f:
+        f.write(text)
+    for alias, _, (vb, pins) in boards:
+        print('%-26s %2d pins' % (alias, len(pins)))
+
+
+if __name__ == '__main__':
+    main()
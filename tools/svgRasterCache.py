@@ -0,0 +1,111 @@
+#!/usr/bin/env python3
+#
+# svgRasterCache.py - pre-renders the board vectors in boardPics/ at several resolutions
+#
+# Board views only need the static board artwork redrawn when resized, so this renders every board
+# listed in boards.qrc to PNG at each requested height, with the OF_pinX highlight elements removed.
+# Apps blit the closest render and draw only the hovered pin on top, using the path data from
+# boardPicsIndex.h (scaled by render height / viewBox height).
+#
+# Renders go to boardPics/raster/<board>@<height>.png, and are listed in boardPics/boardsRaster.qrc
+# under the /boardRasters prefix with the alias <board>@<height>. Both are build outputs and aren't committed.
+#
+# Requires one of: rsvg-convert (librsvg), inkscape (1.x), or the cairosvg Python module.
+#
+# Usage: python3 tools/svgRasterCache.py [--heights 400,800,1600] [--renderer rsvg|inkscape|cairosvg]
+#
+# Copyright That One Seong, 2025
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+import argparse
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import xml.etree.ElementTree as ET
+
+from svgPinIndex import PIN_ID, SVG_NS, read_qrc, view_box
+
+DEFAULT_HEIGHTS = (400, 800, 1600)
+
+
+def find_renderer(name=None):
+    candidates = [name] if name else ['rsvg', 'inkscape', 'cairosvg']
+    for r in candidates:
+        if r == 'rsvg' and shutil.which('rsvg-convert'):
+            return r
+        if r == 'inkscape' and shutil.which('inkscape'):
+            return r
+        if r == 'cairosvg':
+            try:
+                import cairosvg  # noqa: F401
+                return r
+            except ImportError:
+                pass
+    return None
+
+
+def render(renderer, src, dst, height):
+    if renderer == 'rsvg':
+        subprocess.run(['rsvg-convert', '--height', str(height), '--keep-aspect-ratio', '-o', dst, src], check=True)
+    elif renderer == 'inkscape':
+        subprocess.run(['inkscape', '--export-type=png', '--export-height=%d' % height,
+                        '--export-filename=' + dst, src], check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    else:
+        import cairosvg
+        cairosvg.svg2png(url=src, write_to=dst, output_height=height)
+
+
+def without_highlights(path):
+    """Returns the document at path as bytes, minus its OF_pinX highlight elements."""
+    ET.register_namespace('', SVG_NS[1:-1])
+    ET.register_namespace('xlink', 'http://www.w3.org/1999/xlink')
+    tree = ET.parse(path)
+    for parent in list(tree.getroot().iter()):
+        for child in list(parent):
+            if PIN_ID.match(child.get('id', '')):
+                parent.remove(child)
+    return ET.tostring(tree.getroot(), encoding='utf-8', xml_declaration=True), view_box(tree.getroot())
+
+
+def main():
+    here = os.path.dirname(os.path.abspath(__file__))
+    ap = argparse.ArgumentParser()
+    ap.add_argument('--qrc', default=os.path.join(here, '..', 'boardPics', 'boards.qrc'))
+    ap.add_argument('--heights', default=','.join(str(h) for h in DEFAULT_HEIGHTS),
+                    help='comma-separated render heights in pixels (default %(default)s)')
+    ap.add_argument('--renderer', choices=('rsvg', 'inkscape', 'cairosvg'))
+    args = ap.parse_args()
+
+    heights = sorted({int(h) for h in args.heights.split(',')})
+    renderer = find_renderer(args.renderer)
+    if renderer is None:
+        sys.exit('svgRasterCache: no SVG renderer found (install librsvg, inkscape or cairosvg)')
+
+    base = os.path.dirname(os.path.abspath(args.qrc))
+    outdir = os.path.join(base, 'raster')
+    os.makedirs(outdir, exist_ok=True)
+
+    files = []
+    with tempfile.TemporaryDirectory() as tmp:
+        for alias, path in read_qrc(args.qrc):
+            data, vb = without_highlights(path)
+            src = os.path.join(tmp, alias + '.svg')
+            with open(src, 'wb') as f:
+                f.write(data)
+            for h in heights:
+                name = '%s@%d' % (alias, h)
+                render(renderer, src, os.path.join(outdir, name + '.png'), h)
+                files.append((name, 'raster/%s.png' % name))
+            print('%-26s %s' % (alias, ', '.join('%dx%d' % (round(h * vb[2] / vb[3]), h) for h in heights)))
+
+    lines = ['<RCC>', '    <qresource prefix="/boardRasters">']
+    lines += ['        <file alias="%s">%s</file>' % f for f in files]
+    lines += ['    </qresource>', '</RCC>']
+    with open(os.path.join(base, 'boardsRaster.qrc'), 'w', newline='\n') as f:
+        f.write('\n'.join(lines) + '\n')
+
+
+if __name__ == '__main__':
+    main()
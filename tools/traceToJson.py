@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+#
+# traceToJson.py - converts a board's trace dump to a Chrome trace / Perfetto timeline
+#
+# Input is the sTraceDump payload as saved by the app (everything after the sTraceDump byte):
+# a 6-byte header (record count, dropped count) then 8-byte records, as packed by OF_Trace in OpenFIREdiag.h.
+# Event and button names are read from OpenFIREshared.h, so new event types need no changes here
+# as long as they follow the *Down/*Up, *On/*Off, *Start/*End naming for spans.
+#
+# Open the output in chrome://tracing or https://ui.perfetto.dev - each button, the solenoid, rumble
+# and camera frames get their own track, with profile switches and errors as instant markers.
+#
+# Usage: python3 tools/traceToJson.py trace.bin [-o trace.json]
+#
+# Copyright That One Seong, 2025
+# SPDX-License-Identifier: GPL-3.0-or-later
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+from ofSharedEnums import names_of
+
+HEADER = struct.Struct('<HI')
+RECORD = struct.Struct('<IBBH')
+SPAN = re.compile(r'^trace(\w+?)(Down|Up|On|Off|Start|End)$')
+OPENS = ('Down', 'On', 'Start')
+
+
+def read_dump(data):
+    """Returns (dropped, [(time, event, arg, data)]) from an sTraceDump payload."""
+    if len(data) < HEADER.size:
+        raise ValueError('dump is shorter than its header')
+    count, dropped = HEADER.unpack_from(data)
+    if len(data) < HEADER.size + count * RECORD.size:
+        raise ValueError('dump header says %d records, but only %d bytes follow'
+                         % (count, len(data) - HEADER.size))
+    return dropped, [RECORD.unpack_from(data, HEADER.size + i * RECORD.size) for i in range(count)]
+
+
+def unwrap(records):
+    """Yields records with their 32-bit microsecond timestamps made monotonic across wraps."""
+    base, last = 0, None
+    for time, event, arg, data in records:
+        if last is not None and time < last:
+            base += 1 << 32
+        last = time
+        yield base + time, event, arg, data
+
+
+def to_chrome(records, dropped):
+    events = names_of('traceEvents_e')
+    buttons = names_of('boardInputs_e')
+    errors = names_of('serialCmdTypes_e')
+
+    tracks = {}
+    def tid(track):
+        return tracks.setdefault(track, len(tracks) + 1)
+
+    out, start, open_spans = [], None, {}
+    for ts, event, arg, data in unwrap(records):
+        start = ts if start is None else start
+        ts -= start
+        name = events.get(event, 'event%d' % event)
+        span = SPAN.match(name)
+        entry = {'ts': ts, 'pid': 1, 'args': {'arg': arg, 'data': data}}
+        if span:
+            track = span.group(1)
+            if track == 'Btn':
+                track = buttons.get(arg, 'btn%d' % arg)
+            opens = span.group(2) in OPENS
+            if not opens and not open_spans.get(track):
+                continue  # its start was overwritten in the ring before the dump
+            open_spans[track] = open_spans.get(track, 0) + (1 if opens else -1)
+            entry.update(name=track, ph='B' if opens else 'E', tid=tid(track))
+        else:
+            label = name[len('trace'):] if name.startswith('trace') else name
+            if name == 'traceError':
+                label = 'Error ' + errors.get(arg, str(arg))
+            entry.update(name=label, ph='i', s='p', tid=tid('Events'))
+        out.append(entry)
+
+    for track, t in tracks.items():
+        out.append({'name': 'thread_name', 'ph': 'M', 'pid': 1, 'tid': t, 'args': {'name': track}})
+    out.append({'name': 'process_name', 'ph': 'M', 'pid': 1, 'args': {'name': 'OpenFIRE board'}})
+    return {'traceEvents': out, 'displayTimeUnit': 'ms', 'otherData': {'dropped': dropped}}
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('dump', help='sTraceDump payload saved from the board')
+    ap.add_argument('-o', '--out', help='output JSON (default: stdout)')
+    args = ap.parse_args()
+
+    with open(args.dump, 'rb') as f:
+        try:
+            dropped, records = read_dump(f.read())
+        except ValueError as e:
+            sys.exit('traceToJson: %s: %s' % (args.dump, e))
+
+    trace = to_chrome(records, dropped)
+    if args.out:
+        with open(args.out, 'w') as f:
+            json.dump(trace, f, indent=1)
+    else:
+        json.dump(trace, sys.stdout, indent=1)
+    if dropped:
+        print('traceToJson: %d older records were overwritten before the dump' % dropped, file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()